@@ -66,7 +66,7 @@ BadGuy::BadGuy(const Vector& pos, Direction direction, const std::string& sprite
   m_physic(),
   m_is_glinting(false),
   m_is_initialized(false),
-  m_start_position(m_col.m_bbox.p1()),
+  m_start_position(m_col.get_bbox().p1()),
   m_dir(direction),
   m_start_dir(direction),
   m_frozen(false),
@@ -123,7 +123,7 @@ BadGuy::BadGuy(const ReaderMapping& reader, const std::string& sprite_name,
   m_physic(),
   m_is_glinting(false),
   m_is_initialized(false),
-  m_start_position(m_col.m_bbox.p1()),
+  m_start_position(m_col.get_bbox().p1()),
   m_dir(Direction::LEFT),
   m_start_dir(default_direction),
   m_frozen(false),
@@ -224,12 +224,18 @@ BadGuy::draw(DrawingContext& context)
 
       if (m_glowing)
       {
-        m_lightsprite->draw(context.light(), m_col.m_bbox.get_middle() + draw_offset, 0);
+        m_lightsprite->draw(context.light(), m_col.get_bbox().get_middle() + draw_offset, 0);
       }
     }
   }
 }
 
+float
+BadGuy::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *m_lightsprite);
+}
+
 void
 BadGuy::update(float dt_sec)
 {
@@ -337,8 +343,8 @@ BadGuy::update(float dt_sec)
       {
         if (graphicsRandom.rand(0, 8) == 0)
         {
-          const float px = graphicsRandom.randf(m_col.m_bbox.get_left(), m_col.m_bbox.get_right());
-          const float py = graphicsRandom.randf(m_col.m_bbox.get_top(), m_col.m_bbox.get_bottom());
+          const float px = graphicsRandom.randf(m_col.get_bbox().get_left(), m_col.get_bbox().get_right());
+          const float py = graphicsRandom.randf(m_col.get_bbox().get_top(), m_col.get_bbox().get_bottom());
           const Vector ppos = Vector(px, py);
           Sector::get().add<SpriteParticle>(
             "images/particles/glint.sprite",
@@ -416,7 +422,7 @@ BadGuy::update(float dt_sec)
       m_is_active_flag = false;
       m_col.set_movement(m_physic.get_movement(dt_sec));
       if ( m_sprite->animation_done() || on_ground() ) {
-        Sector::get().add<WaterDrop>(m_col.m_bbox.p1(), get_water_sprite(), m_physic.get_velocity());
+        Sector::get().add<WaterDrop>(m_col.get_bbox().p1(), get_water_sprite(), m_physic.get_velocity());
         remove_me();
         break;
       }
@@ -438,8 +444,8 @@ BadGuy::update(float dt_sec)
         set_state(STATE_GEAR);
       }
       int pa = graphicsRandom.rand(0,3);
-      float px = graphicsRandom.randf(m_col.m_bbox.get_left(), m_col.m_bbox.get_right());
-      float py = graphicsRandom.randf(m_col.m_bbox.get_top(), m_col.m_bbox.get_bottom());
+      float px = graphicsRandom.randf(m_col.get_bbox().get_left(), m_col.get_bbox().get_right());
+      float py = graphicsRandom.randf(m_col.get_bbox().get_top(), m_col.get_bbox().get_bottom());
       Vector ppos = Vector(px, py);
       Sector::get().add<SpriteParticle>(get_water_sprite(), "particle_" + std::to_string(pa),
                                              ppos, ANCHOR_MIDDLE,
@@ -597,7 +603,7 @@ BadGuy::collision(MovingObject& other, const CollisionHit& hit)
   if (player) {
 
     // Hit from above?
-    if (player->get_bbox().get_bottom() < (m_col.m_bbox.get_top() + 16)) {
+    if (player->get_bbox().get_bottom() < (m_col.get_bbox().get_top() + 16)) {
       if (player->is_stone()) {
         kill_fall();
         return FORCE_MOVE;
@@ -821,14 +827,14 @@ BadGuy::kill_fall()
   if (m_frozen) {
     SoundManager::current()->play("sounds/brick.wav", get_pos());
     Vector pr_pos(0.0f, 0.0f);
-    float cx = m_col.m_bbox.get_width() / 2.f;
-    float cy = m_col.m_bbox.get_height() / 2.f;
-    for (pr_pos.x = 0.f; pr_pos.x < m_col.m_bbox.get_width(); pr_pos.x +=  18.f) {
-      for (pr_pos.y = 0.f; pr_pos.y < m_col.m_bbox.get_height(); pr_pos.y += 18.f) {
+    float cx = m_col.get_bbox().get_width() / 2.f;
+    float cy = m_col.get_bbox().get_height() / 2.f;
+    for (pr_pos.x = 0.f; pr_pos.x < m_col.get_bbox().get_width(); pr_pos.x +=  18.f) {
+      for (pr_pos.y = 0.f; pr_pos.y < m_col.get_bbox().get_height(); pr_pos.y += 18.f) {
         Vector speed = Vector((pr_pos.x - cx) * 3.f, (pr_pos.y - cy) * 2.f);
         Sector::get().add<SpriteParticle>(
             "images/particles/ice_piece"+std::to_string(graphicsRandom.rand(1, 3))+".sprite", "default",
-            m_col.m_bbox.p1() + pr_pos, ANCHOR_MIDDLE,
+            m_col.get_bbox().p1() + pr_pos, ANCHOR_MIDDLE,
             //SPEED: Add current enemy speed, but do not add downwards velocity because it looks bad.
             Vector(m_physic.get_velocity_x(), m_physic.get_velocity_y() > 0.f ? 0.f : m_physic.get_velocity_y())
             //SPEED: Add specified speed and randomization.
@@ -938,7 +944,7 @@ BadGuy::is_offscreen() const
   Vector cam_dist(0.0f, 0.0f);
   Vector player_dist(0.0f, 0.0f);
   Camera& cam = Sector::get().get_camera();
-  cam_dist = cam.get_center() - m_col.m_bbox.get_middle();
+  cam_dist = cam.get_center() - m_col.get_bbox().get_middle();
   if (Editor::is_active()) {
       if ((fabsf(cam_dist.x) <= X_OFFSCREEN_DISTANCE) && (fabsf(cam_dist.y) <= Y_OFFSCREEN_DISTANCE)) {
         return false;
@@ -948,7 +954,7 @@ BadGuy::is_offscreen() const
   if (!player)
     return false;
   if (!Editor::is_active()) {
-    player_dist = player->get_bbox().get_middle() - m_col.m_bbox.get_middle();
+    player_dist = player->get_bbox().get_middle() - m_col.get_bbox().get_middle();
   }
   // In SuperTux 0.1.x, Badguys were activated when Tux<->Badguy center distance was approx. <= ~668px.
   // This doesn't work for wide-screen monitors which give us a virt. res. of approx. 1066px x 600px.
@@ -973,7 +979,7 @@ BadGuy::try_activate()
       // If starting direction was set to AUTO, this is our chance to re-orient the badguy.
       if (m_start_dir == Direction::AUTO) {
         auto player_ = get_nearest_player();
-        if (player_ && (player_->get_bbox().get_left() > m_col.m_bbox.get_right())) {
+        if (player_ && (player_->get_bbox().get_left() > m_col.get_bbox().get_right())) {
           m_dir = Direction::RIGHT;
         } else {
           m_dir = Direction::LEFT;
@@ -1080,7 +1086,7 @@ BadGuy::might_fall(int height)
 Player*
 BadGuy::get_nearest_player() const
 {
-  return Sector::get().get_nearest_player(m_col.m_bbox);
+  return Sector::get().get_nearest_player(m_col.get_bbox());
 }
 
 void
@@ -1242,14 +1248,14 @@ BadGuy::unfreeze(bool melt)
 
   SoundManager::current()->play(melt ? "sounds/splash.ogg" : "sounds/brick.wav", get_pos());
   Vector pr_pos(0.0f, 0.0f);
-  float cx = m_col.m_bbox.get_width() / 2.f;
+  float cx = m_col.get_bbox().get_width() / 2.f;
   std::string particle_sprite_name = melt ? "images/particles/water_piece" : "images/particles/ice_piece";
-  for (pr_pos.x = 0; pr_pos.x < m_col.m_bbox.get_width(); pr_pos.x += 16.f) {
-    for (pr_pos.y = 0; pr_pos.y < m_col.m_bbox.get_height(); pr_pos.y += 16.f) {
+  for (pr_pos.x = 0; pr_pos.x < m_col.get_bbox().get_width(); pr_pos.x += 16.f) {
+    for (pr_pos.y = 0; pr_pos.y < m_col.get_bbox().get_height(); pr_pos.y += 16.f) {
       Vector speed = Vector((pr_pos.x - cx) * 2.f, 0.f);
       Sector::get().add<SpriteParticle>(
         particle_sprite_name + std::to_string(graphicsRandom.rand(1, 3)) + ".sprite", "default",
-        m_col.m_bbox.p1() + pr_pos, ANCHOR_MIDDLE,
+        m_col.get_bbox().p1() + pr_pos, ANCHOR_MIDDLE,
         //SPEED: add current enemy speed but do not add downwards velocity because it looks bad.
         Vector(m_physic.get_velocity_x(), m_physic.get_velocity_y() > 0.f ? 0.f : m_physic.get_velocity_y())
         //SPEED: add specified speed and randomization.
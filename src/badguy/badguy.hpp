@@ -68,6 +68,7 @@ public:
   /** Called when the badguy is drawn. The default implementation
       simply draws the badguy sprite on screen */
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   /** Called each frame. The default implementation checks badguy
       state and calls active_update and inactive_update */
@@ -22,6 +22,8 @@ namespace
 
 #include "badguy/boss.hpp"
 
+#include <limits>
+
 #include "editor/editor.hpp"
 #include "object/player.hpp"
 #include "sprite/sprite.hpp"
@@ -65,6 +67,13 @@ Boss::draw(DrawingContext& context)
   BadGuy::draw(context);
 }
 
+float
+Boss::get_draw_margin() const
+{
+  // The health bar is drawn in screen coordinates.
+  return std::numeric_limits<float>::infinity();
+}
+
 void
 Boss::draw_hit_points(DrawingContext& context)
 {
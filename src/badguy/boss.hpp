@@ -27,6 +27,7 @@ public:
   Boss(const ReaderMapping& mapping, const std::string& sprite_name, int layer = LAYER_OBJECTS, const std::string& light_sprite = DEFAULT_LIGHT_SPRITE);
   virtual void boss_update(float dt_sec);
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   void draw_hit_points(DrawingContext& context);
   virtual ObjectSettings get_settings() override;
   virtual GameObjectClasses get_class_types() const override { return BadGuy::get_class_types().add(typeid(Boss)); }
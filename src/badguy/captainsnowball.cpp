@@ -40,16 +40,16 @@ CaptainSnowball::might_climb(int width, int height) const
 
   float x1;
   float x2;
-  float y1a = m_col.m_bbox.get_top() + 1;
-  float y2a = m_col.m_bbox.get_bottom() - 1;
-  float y1b = m_col.m_bbox.get_top() + 1 - static_cast<float>(height);
-  float y2b = m_col.m_bbox.get_bottom() - 1 - static_cast<float>(height);
+  float y1a = m_col.get_bbox().get_top() + 1;
+  float y2a = m_col.get_bbox().get_bottom() - 1;
+  float y1b = m_col.get_bbox().get_top() + 1 - static_cast<float>(height);
+  float y2b = m_col.get_bbox().get_bottom() - 1 - static_cast<float>(height);
   if (m_dir == Direction::LEFT) {
-    x1 = m_col.m_bbox.get_left() - static_cast<float>(width);
-    x2 = m_col.m_bbox.get_left() - 1;
+    x1 = m_col.get_bbox().get_left() - static_cast<float>(width);
+    x2 = m_col.get_bbox().get_left() - 1;
   } else {
-    x1 = m_col.m_bbox.get_right() + 1;
-    x2 = m_col.m_bbox.get_right() + static_cast<float>(width);
+    x1 = m_col.get_bbox().get_right() + 1;
+    x2 = m_col.get_bbox().get_right() + static_cast<float>(width);
   }
   return ((!Sector::get().is_free_of_statics(Rectf(x1, y1a, x2, y2a))) &&
           (Sector::get().is_free_of_statics(Rectf(x1, y1b, x2, y2b))));
@@ -844,7 +844,7 @@ Crusher::on_flip(float height)
 {
   MovingSprite::on_flip(height);
   m_flipped = !m_flipped;
-  m_start_position.y = height - m_col.m_bbox.get_height() - m_start_position.y;
+  m_start_position.y = height - m_col.get_bbox().get_height() - m_start_position.y;
   FlipLevelTransformer::transform_flip(m_flip);
 
   if (m_dir == CrusherDirection::DOWN)
@@ -37,6 +37,7 @@ public:
   virtual void kill_fall() override;
 
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   virtual void active_update(float dt_sec) override;
 
   virtual void ignite() override;
@@ -80,8 +80,8 @@ GhostTree::activate()
 Vector
 GhostTree::get_attack_pos() const
 {
-  const float middle = m_col.m_bbox.get_middle().x;
-  const float base = m_col.m_bbox.get_bottom() + 96;
+  const float middle = m_col.get_bbox().get_middle().x;
+  const float base = m_col.get_bbox().get_bottom() + 96;
 
   // NOTE: This should never be the case when entering SPITTING state.
   if (m_attack == ATTACK_NORMAL)
@@ -226,8 +226,8 @@ GhostTree::rotate_willo_color() {
 
 void
 GhostTree::spawn_willowisp(AttackType color) {
-  Vector pos(m_col.m_bbox.get_width() / 2,
-  m_col.m_bbox.get_height() / 2 + (m_flip == NO_FLIP
+  Vector pos(m_col.get_bbox().get_width() / 2,
+  m_col.get_bbox().get_height() / 2 + (m_flip == NO_FLIP
                                    ? (m_willo_spawn_y + WILLOWISP_TOP_OFFSET)
                                    : -(m_willo_spawn_y + WILLOWISP_TOP_OFFSET + 32.0f)));
   auto& willowisp = Sector::get().add<TreeWillOWisp>(this, pos, 200 + m_willo_radius, m_willo_speed);
@@ -304,7 +304,7 @@ GhostTree::set_state(MyState new_state) {
 
       for (const auto& willo : m_willowisps) {
         if (should_suck(willo->get_color())) {
-          willo->start_sucking(m_col.m_bbox.get_middle() + SUCK_TARGET_OFFSET
+          willo->start_sucking(m_col.get_bbox().get_middle() + SUCK_TARGET_OFFSET
                                + Vector(gameRandom.randf(-SUCK_TARGET_SPREAD, SUCK_TARGET_SPREAD),
                                         gameRandom.randf(-SUCK_TARGET_SPREAD, SUCK_TARGET_SPREAD)),
                                2.5f);
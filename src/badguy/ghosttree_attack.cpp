@@ -240,7 +240,7 @@ GhostTreeRootRed::GhostTreeRootRed(const Vector& pos, GhostTreeAttack* parent):
 
   SoundManager::current()->preload("sounds/darthit.wav");
 
-  m_level_top -= m_col.m_bbox.get_height();
+  m_level_top -= m_col.get_bbox().get_height();
 }
 
 GhostTreeRootRed::~GhostTreeRootRed()
@@ -276,7 +276,7 @@ GhostTreeRootGreen::GhostTreeRootGreen(const Vector& pos, GhostTreeAttack* paren
   m_parent(parent)
 {
   m_physic.set_velocity_y(-GREEN_ROOT_SPEED);
-  m_level_top -= m_col.m_bbox.get_height();
+  m_level_top -= m_col.get_bbox().get_height();
 }
 
 GhostTreeRootGreen::~GhostTreeRootGreen()
@@ -291,7 +291,7 @@ GhostTreeRootGreen::active_update(float dt_sec)
     return;
   }
 
-  Sector::get().add<Explosion>(m_col.m_bbox.get_middle(), 0.f);
+  Sector::get().add<Explosion>(m_col.get_bbox().get_middle(), 0.f);
 
   Sector::get().add<Shard>(get_bbox().get_middle(), Vector(100.f, -500.f),  GREEN_ROOT_SHARD_SPRITE);
   Sector::get().add<Shard>(get_bbox().get_middle(), Vector(270.f, -350.f),  GREEN_ROOT_SHARD_SPRITE);
@@ -313,7 +313,7 @@ GhostTreeRootBlue::GhostTreeRootBlue(const Vector& pos, GhostTreeAttack* parent)
 {
   m_physic.set_velocity_y(-BLUE_ROOT_SPEED);
   set_action("variant" + std::to_string(m_variant));
-  m_level_top -= m_col.m_bbox.get_height();
+  m_level_top -= m_col.get_bbox().get_height();
 }
 
 GhostTreeRootBlue::~GhostTreeRootBlue()
@@ -381,7 +381,7 @@ GhostTreeRootPinch::GhostTreeRootPinch(const Vector& pos, GhostTreeAttack* paren
   m_parent(parent)
 {
   m_physic.set_velocity_y(-PINCH_ROOT_SPEED);
-  m_level_top -= m_col.m_bbox.get_height();
+  m_level_top -= m_col.get_bbox().get_height();
 }
 
 GhostTreeRootPinch::~GhostTreeRootPinch()
@@ -409,7 +409,7 @@ GhostTreeRootPinch::active_update(float dt_sec)
       break;
     case STATE_EXPLOSION_DELAY:
       if (m_state_timer.check()) {
-        Sector::get().add<Explosion>(m_col.m_bbox.get_middle(), EXPLOSION_STRENGTH_DEFAULT);
+        Sector::get().add<Explosion>(m_col.get_bbox().get_middle(), EXPLOSION_STRENGTH_DEFAULT);
 
         Sector::get().add<Shard>(get_bbox().get_middle(), Vector(100.f, -500.f),  GREEN_ROOT_SHARD_SPRITE);
         Sector::get().add<Shard>(get_bbox().get_middle(), Vector(270.f, -350.f),  GREEN_ROOT_SHARD_SPRITE);
@@ -388,7 +388,7 @@ Ghoul::get_settings()
 bool
 Ghoul::collision_squished(MovingObject& object)
 {
-  auto player = Sector::get().get_nearest_player(m_col.m_bbox);
+  auto player = Sector::get().get_nearest_player(m_col.get_bbox());
   if (player)
     player->bounce(*this);
 
@@ -32,6 +32,7 @@ public:
 
   virtual void active_update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   virtual bool is_freezable() const override;
   virtual void freeze() override;
@@ -45,7 +45,7 @@ Kugelblitz::Kugelblitz(const ReaderMapping& reader) :
   direction(),
   lightsprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite"))
 {
-  m_start_position.x = m_col.m_bbox.get_left();
+  m_start_position.x = m_col.get_bbox().get_left();
   set_action("falling");
   m_physic.enable_gravity(false);
   m_can_glint = false;
@@ -79,7 +79,7 @@ Kugelblitz::collision_player(Player& player, const CollisionHit& )
   }
   // Did the collision occur from above?
   if (player.get_movement().y - get_movement().y > 0 && player.get_bbox().get_bottom() <
-     (m_col.m_bbox.get_top() + m_col.m_bbox.get_bottom()) / 2) {
+     (m_col.get_bbox().get_top() + m_col.get_bbox().get_bottom()) / 2) {
     // If not, and if it's possible for the player to squish us, then this collision will hurt.
     if (!collision_squished(player))
       player.kill(false);
@@ -152,7 +152,13 @@ void
 Kugelblitz::draw(DrawingContext& context)
 {
   m_sprite->draw(context.color(), get_pos(), m_layer);
-  lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+  lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), 0);
+}
+
+float
+Kugelblitz::get_draw_margin() const
+{
+  return add_sprite_margin(BadGuy::get_draw_margin(), *lightsprite);
 }
 
 void
@@ -165,7 +171,7 @@ void
 Kugelblitz::explode()
 {
   if (!dying) {
-    SoundManager::current()->play("sounds/lightning.wav", m_col.m_bbox.p1());
+    SoundManager::current()->play("sounds/lightning.wav", m_col.get_bbox().p1());
     set_action("pop");
     lifetime.start(0.2f);
     dying = true;
@@ -182,7 +188,7 @@ Kugelblitz::try_activate()
 
   auto player_ = get_nearest_player();
   if (!player_) return;
-  Vector dist = player_->get_bbox().get_middle() - m_col.m_bbox.get_middle();
+  Vector dist = player_->get_bbox().get_middle() - m_col.get_bbox().get_middle();
   if ((fabsf(dist.x) <= X_OFFSCREEN_DISTANCE) && (fabsf(dist.y) <= Y_OFFSCREEN_DISTANCE)) {
     set_state(STATE_ACTIVE);
     if (!m_is_initialized) {
@@ -190,7 +196,7 @@ Kugelblitz::try_activate()
       // If the starting direction was set to AUTO, this is our chance to re-orient the badguy.
       if (m_start_dir == Direction::AUTO) {
         Player* player__ = get_nearest_player();
-        if (player__ && (player__->get_bbox().get_left() > m_col.m_bbox.get_right())) {
+        if (player__ && (player__->get_bbox().get_left() > m_col.get_bbox().get_right())) {
           m_dir = Direction::RIGHT;
         } else {
           m_dir = Direction::LEFT;
@@ -35,6 +35,7 @@ public:
   virtual bool is_flammable() const override;
 
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   static std::string class_name() { return "kugelblitz"; }
   virtual std::string get_class_name() const override { return class_name(); }
   static std::string display_name() { return _("Kugelblitz"); }
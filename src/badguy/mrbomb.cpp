@@ -186,6 +186,12 @@ MrBomb::draw(DrawingContext& context)
   WalkingBadguy::draw(context);
 }
 
+float
+MrBomb::get_draw_margin() const
+{
+  return add_sprite_margin(WalkingBadguy::get_draw_margin(), *m_exploding_sprite);
+}
+
 void
 MrBomb::trigger(Player* player)
 {
@@ -209,7 +215,7 @@ void
 MrBomb::explode()
 {
   remove_me();
-  Sector::get().add<Explosion>(m_col.m_bbox.get_middle(),
+  Sector::get().add<Explosion>(m_col.get_bbox().get_middle(),
     EXPLOSION_STRENGTH_DEFAULT);
   run_dead_script();
 }
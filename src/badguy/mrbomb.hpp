@@ -36,6 +36,7 @@ public:
 
   virtual void active_update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   virtual void grab(MovingObject& object, const Vector& pos, Direction dir) override;
   virtual void ungrab(MovingObject& object, Direction dir) override;
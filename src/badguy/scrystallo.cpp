@@ -97,7 +97,7 @@ SCrystallo::active_update(float dt_sec)
     // The entity is sleeping peacefully.
     if (player)
     {
-      Vector p1 = m_col.m_bbox.get_middle();
+      Vector p1 = m_col.get_bbox().get_middle();
       Vector p2 = player->get_bbox().get_middle();
       Vector dist = (p2 - p1);
       if (glm::length(dist) <= m_range)
@@ -193,7 +193,7 @@ SkyDive::explode()
   else
   {
     Sector::get().add<Explosion>(
-      get_anchor_pos(m_col.m_bbox, ANCHOR_BOTTOM), EXPLOSION_STRENGTH_DEFAULT);
+      get_anchor_pos(m_col.get_bbox(), ANCHOR_BOTTOM), EXPLOSION_STRENGTH_DEFAULT);
 
     remove_me();
   }
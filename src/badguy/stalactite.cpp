@@ -55,11 +55,11 @@ Stalactite::active_update(float dt_sec)
   if (state == STALACTITE_HANGING) {
     auto player = get_nearest_player();
     if (player && !player->get_ghost_mode()) {
-      if (player->get_bbox().get_right() > m_col.m_bbox.get_left() - SHAKE_RANGE_X
-         && player->get_bbox().get_left() < m_col.m_bbox.get_right() + SHAKE_RANGE_X
-         && player->get_bbox().get_bottom() > m_col.m_bbox.get_top()
-         && player->get_bbox().get_top() < m_col.m_bbox.get_bottom() + SHAKE_RANGE_Y
-         && Sector::get().can_see_player(m_col.m_bbox.get_middle())) {
+      if (player->get_bbox().get_right() > m_col.get_bbox().get_left() - SHAKE_RANGE_X
+         && player->get_bbox().get_left() < m_col.get_bbox().get_right() + SHAKE_RANGE_X
+         && player->get_bbox().get_bottom() > m_col.get_bbox().get_top()
+         && player->get_bbox().get_top() < m_col.get_bbox().get_bottom() + SHAKE_RANGE_Y
+         && Sector::get().can_see_player(m_col.get_bbox().get_middle())) {
         timer.start(SHAKE_TIME);
         state = STALACTITE_SHAKING;
         SoundManager::current()->play("sounds/cracking.wav", get_pos());
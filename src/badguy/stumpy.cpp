@@ -59,7 +59,7 @@ Stumpy::initialize()
   switch (mystate) {
     case STATE_INVINCIBLE:
       set_action("dizzy", m_dir);
-      m_col.m_bbox.set_size(m_sprite->get_current_hitbox_width(), m_sprite->get_current_hitbox_height());
+      m_col.set_size(m_sprite->get_current_hitbox_width(), m_sprite->get_current_hitbox_height());
       m_physic.set_velocity_x(0);
       break;
     case STATE_NORMAL:
@@ -109,7 +109,7 @@ Stumpy::collision_squished(MovingObject& object)
     // Spawn some particles.
     // TODO: Provide convenience function in MovingSprite or MovingObject?
     for (int i = 0; i < 25; i++) {
-      Vector ppos = m_col.m_bbox.get_middle();
+      Vector ppos = m_col.get_bbox().get_middle();
       float angle = graphicsRandom.randf(-math::PI_2, math::PI_2);
       float velocity = graphicsRandom.randf(45, 90);
       float vx = sinf(angle)*velocity;
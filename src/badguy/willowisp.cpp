@@ -112,14 +112,14 @@ WillOWisp::synchronize_position_from_path()
     m_starting_node = size - 1;
   }
 
-  set_pos(m_path_handle.get_pos(m_col.m_bbox.get_size(), nodes[m_starting_node].position));
+  set_pos(m_path_handle.get_pos(m_col.get_bbox().get_size(), nodes[m_starting_node].position));
 }
 
 void
 WillOWisp::finish_construction()
 {
   if (!get_path())
-    init_path_pos(m_col.m_bbox.p1());
+    init_path_pos(m_col.get_bbox().p1());
 
   synchronize_position_from_path();
 
@@ -167,13 +167,13 @@ WillOWisp::active_update(float dt_sec)
   if (Editor::is_active() && get_path() && get_path()->is_valid())
   {
     get_walker()->update(dt_sec);
-    set_pos(get_walker()->get_pos(m_col.m_bbox.get_size(), m_path_handle));
+    set_pos(get_walker()->get_pos(m_col.get_bbox().get_size(), m_path_handle));
     return;
   }
 
   auto player = get_nearest_player();
   if (!player) return;
-  const Vector p1 = m_col.m_bbox.get_middle();
+  const Vector p1 = m_col.get_bbox().get_middle();
   const Vector p2 = player->get_bbox().get_middle();
   Vector dist = (p2 - p1);
 
@@ -232,7 +232,7 @@ WillOWisp::active_update(float dt_sec)
 
       get_walker()->update(dt_sec);
 
-      m_col.set_movement(get_walker()->get_pos(m_col.m_bbox.get_size(), m_path_handle) - get_pos());
+      m_col.set_movement(get_walker()->get_pos(m_col.get_bbox().get_size(), m_path_handle) - get_pos());
       if (m_mystate == STATE_PATHMOVING_TRACK && glm::length(dist) <= m_track_range)
       {
         m_mystate = STATE_TRACKING;
@@ -440,7 +440,7 @@ WillOWisp::play_looping_sounds()
 void
 WillOWisp::move_to(const Vector& pos)
 {
-  Vector shift = pos - m_col.m_bbox.p1();
+  Vector shift = pos - m_col.get_bbox().p1();
   if (get_path())
   {
     get_path()->move_by(shift);
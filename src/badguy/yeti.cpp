@@ -108,10 +108,10 @@ Yeti::recalculate_pos()
   float sectorw = Sector::get().get_width();
 
   if (m_dir == Direction::RIGHT) {
-    m_left_stand_x = m_col.m_bbox.get_left();
-    m_right_stand_x = sectorw - m_left_stand_x - m_col.m_bbox.get_width();
+    m_left_stand_x = m_col.get_bbox().get_left();
+    m_right_stand_x = sectorw - m_left_stand_x - m_col.get_bbox().get_width();
   } else {
-    m_right_stand_x = m_col.m_bbox.get_left();
+    m_right_stand_x = m_col.get_bbox().get_left();
     m_left_stand_x = sectorw - m_right_stand_x;
   }
 
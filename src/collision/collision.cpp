@@ -18,6 +18,7 @@
 
 #include <algorithm>
 
+#include "supertux/constants.hpp"
 #include "supertux/physic.hpp"
 #include "collision/collision_object.hpp"
 #include "math/aatriangle.hpp"
@@ -176,6 +177,109 @@ bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
   return true;
 }
 
+bool rectangle_rectangle_constraints(Constraints* constraints, const Vector& movement,
+                                     const Rectf& moving_rect, const Rectf& other_rect,
+                                     const RectanglePairState& state)
+{
+  // Slightly growing the static object's rectangle to detect a
+  // collision not only when they overlap, but also when they're
+  // adjacent or at least extremely close.
+  const Rectf grown_other_rect = other_rect.grown(EPSILON);
+
+  if (!moving_rect.overlaps(grown_other_rect))
+    return false;
+
+  // Calculate intersection.
+  const float itop = moving_rect.get_bottom() - grown_other_rect.get_top();
+  const float ibottom = grown_other_rect.get_bottom() - moving_rect.get_top();
+  const float ileft = moving_rect.get_right() - grown_other_rect.get_left();
+  const float iright = grown_other_rect.get_right() - moving_rect.get_left();
+
+  bool shiftout = false;
+
+  if (!state.other_unisolid && !state.moving_unisolid)
+  {
+    if (fabsf(movement.y) > fabsf(movement.x)) {
+      if (ileft < SHIFT_DELTA) {
+        constraints->constrain_right(grown_other_rect.get_left());
+        shiftout = true;
+      }
+      else if (iright < SHIFT_DELTA) {
+        constraints->constrain_left(grown_other_rect.get_right());
+        shiftout = true;
+      }
+    }
+    else {
+      // Shiftout bottom/top.
+      if (itop < SHIFT_DELTA) {
+        constraints->constrain_bottom(grown_other_rect.get_top());
+        shiftout = true;
+      }
+      else if (ibottom < SHIFT_DELTA) {
+        constraints->constrain_top(grown_other_rect.get_bottom());
+        shiftout = true;
+      }
+    }
+  }
+
+  if (!shiftout)
+  {
+    if (state.other_unisolid)
+    {
+      // Constrain only on fall on top of the unisolid object.
+      if (moving_rect.get_bottom() - movement.y <= grown_other_rect.get_top() - (state.other_movement_y - 5.f))
+      {
+        constraints->constrain_bottom(other_rect.get_top());
+        constraints->hit.bottom = true;
+      }
+    }
+    else if (state.other_moving_static && state.moving_unisolid)
+    {
+      // Similar to the above, except... hacky?
+      // This prevents weird issues with rocks and granitos.
+      if (grown_other_rect.get_top() - state.other_movement_y <= moving_rect.get_top() - (movement.y - 5.f))
+      {
+        constraints->constrain_top(moving_rect.get_top());
+        constraints->hit.top = true;
+      }
+    }
+    else
+    {
+      const float vert_penetration = std::min(itop, ibottom);
+      const float horiz_penetration = std::min(ileft, iright);
+
+      if (vert_penetration < horiz_penetration)
+      {
+        if (itop < ibottom)
+        {
+          constraints->constrain_bottom(grown_other_rect.get_top());
+          constraints->hit.bottom = true;
+        }
+        else
+        {
+          constraints->constrain_top(grown_other_rect.get_bottom());
+          constraints->hit.top = true;
+        }
+      }
+      else
+      {
+        if (ileft < iright)
+        {
+          constraints->constrain_right(grown_other_rect.get_left());
+          constraints->hit.right = true;
+        }
+        else
+        {
+          constraints->constrain_left(grown_other_rect.get_right());
+          constraints->hit.left = true;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 void set_rectangle_rectangle_constraints(Constraints* constraints, const Rectf& r1, const Rectf& r2)
 {
   float itop = r1.get_bottom() - r2.get_top();
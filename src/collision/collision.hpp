@@ -102,6 +102,34 @@ private:
   float position_bottom;
 };
 
+/** The state of a moving object and of the object it is tested
+    against, besides their rectangles, that rectangle_rectangle_constraints()
+    depends on. Left at the defaults for tiles. */
+struct RectanglePairState
+{
+  bool moving_unisolid = false;
+  bool other_unisolid = false;
+  bool other_moving_static = false;
+  float other_movement_y = 0.0f;
+
+  bool operator==(const RectanglePairState& other) const
+  {
+    return moving_unisolid == other.moving_unisolid &&
+      other_unisolid == other.other_unisolid &&
+      other_moving_static == other.other_moving_static &&
+      other_movement_y == other.other_movement_y;
+  }
+};
+
+/** Calculates the constraints that other_rect puts on moving_rect,
+ * which moves by movement. Only reads its arguments, so it can be
+ * called from any thread. Returns false if the rectangles don't touch;
+ * the constraints can be empty even if they do.
+ */
+bool rectangle_rectangle_constraints(Constraints* constraints, const Vector& movement,
+                                     const Rectf& moving_rect, const Rectf& other_rect,
+                                     const RectanglePairState& state);
+
 /** does collision detection between a rectangle and an axis aligned triangle
  * Returns true in case of a collision and fills in the hit structure then.
  */
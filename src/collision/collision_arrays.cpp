@@ -0,0 +1,182 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "collision/collision_arrays.hpp"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+
+CollisionArrays::CollisionArrays() :
+  m_bbox(),
+  m_dest(),
+  m_movement(),
+  m_group(),
+  m_valid(),
+  m_grid(),
+  m_grid_rects(),
+  m_index_dirty(true),
+  m_updating(false)
+{
+}
+
+uint32_t
+CollisionArrays::add(uint8_t group, const Rectf& bbox, const Vector& movement)
+{
+  const uint32_t slot = static_cast<uint32_t>(m_bbox.size());
+  m_bbox.push_back(bbox);
+  m_dest.push_back(bbox);
+  m_movement.push_back(movement);
+  m_group.push_back(group);
+  m_valid.push_back(true);
+
+  if (!m_index_dirty) {
+    m_grid_rects.push_back(bbox);
+    m_grid.insert(slot, bbox);
+  }
+  return slot;
+}
+
+void
+CollisionArrays::remove(uint32_t slot)
+{
+  assert(slot < m_bbox.size());
+  const uint32_t last_slot = static_cast<uint32_t>(m_bbox.size() - 1);
+
+  if (!m_index_dirty) {
+    m_grid.remove(slot, m_grid_rects[slot]);
+    if (slot != last_slot) {
+      m_grid.remove(last_slot, m_grid_rects[last_slot]);
+      m_grid.insert(slot, m_grid_rects[last_slot]);
+      m_grid_rects[slot] = m_grid_rects[last_slot];
+    }
+    m_grid_rects.pop_back();
+  }
+
+  m_bbox[slot] = m_bbox[last_slot];
+  m_dest[slot] = m_dest[last_slot];
+  m_movement[slot] = m_movement[last_slot];
+  m_group[slot] = m_group[last_slot];
+  m_valid[slot] = m_valid[last_slot];
+
+  m_bbox.pop_back();
+  m_dest.pop_back();
+  m_movement.pop_back();
+  m_group.pop_back();
+  m_valid.pop_back();
+}
+
+void
+CollisionArrays::set_bbox(uint32_t slot, const Rectf& bbox, const Rectf& dest)
+{
+  m_bbox[slot] = bbox;
+  m_dest[slot] = dest;
+
+  // During a step, the grid holds the destinations, which are moved
+  // by update_broadphase() and end_update(). Outside of it, objects
+  // are moved one by one all the time, so only this entry is moved
+  // instead of rebuilding the grid on the next query.
+  if (!m_updating && !m_index_dirty)
+  {
+    m_grid.move(slot, m_grid_rects[slot], bbox);
+    m_grid_rects[slot] = bbox;
+  }
+}
+
+void
+CollisionArrays::begin_update(float max_speed)
+{
+  const size_t count = m_bbox.size();
+  for (size_t i = 0; i < count; ++i)
+  {
+    // Make sure movement is never faster than max_speed.
+    if (glm::length(m_movement[i]) > max_speed)
+      m_movement[i] = glm::normalize(m_movement[i]) * max_speed;
+
+    m_dest[i] = m_bbox[i];
+    m_dest[i].move(m_movement[i]);
+  }
+
+  m_grid_rects = m_dest;
+  fill_grid();
+  m_updating = true;
+}
+
+bool
+CollisionArrays::update_broadphase(uint32_t slot)
+{
+  if (m_grid_rects[slot] == m_dest[slot])
+    return false;
+
+  m_grid.move(slot, m_grid_rects[slot], m_dest[slot]);
+  m_grid_rects[slot] = m_dest[slot];
+  return true;
+}
+
+void
+CollisionArrays::end_update()
+{
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_bbox.size()); ++i)
+  {
+    update_broadphase(i);
+    m_bbox[i] = m_dest[i];
+    m_movement[i] = Vector(0.0f, 0.0f);
+  }
+  m_updating = false;
+}
+
+void
+CollisionArrays::update_index()
+{
+  if (!m_index_dirty)
+    return;
+
+  m_grid_rects = m_bbox;
+  fill_grid();
+}
+
+void
+CollisionArrays::fill_grid()
+{
+  Rectf bounds;
+  bool has_bounds = false;
+  for (const auto& rect : m_grid_rects)
+  {
+    if (!std::isfinite(rect.get_left()) || !std::isfinite(rect.get_top()) ||
+        !std::isfinite(rect.get_right()) || !std::isfinite(rect.get_bottom()))
+      continue;
+
+    if (!has_bounds)
+    {
+      bounds = rect;
+      has_bounds = true;
+    }
+    else
+    {
+      bounds = Rectf(std::min(bounds.get_left(), rect.get_left()),
+                     std::min(bounds.get_top(), rect.get_top()),
+                     std::max(bounds.get_right(), rect.get_right()),
+                     std::max(bounds.get_bottom(), rect.get_bottom()));
+    }
+  }
+
+  m_grid.reset(bounds);
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_grid_rects.size()); ++i)
+    m_grid.insert(i, m_grid_rects[i]);
+
+  m_index_dirty = false;
+}
@@ -0,0 +1,123 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "collision/collision_grid.hpp"
+#include "math/rectf.hpp"
+#include "math/vector.hpp"
+
+/**
+ * The state of the objects of a CollisionSystem that update() reads
+ * most, kept in contiguous arrays indexed by the slot of the object,
+ * so that its passes can filter objects without touching them. Also
+ * holds the grid, which is the broadphase during update() and the
+ * spatial index for queries otherwise.
+ *
+ * Slots are dense: removing an entry moves the last entry into its
+ * slot.
+ */
+class CollisionArrays final
+{
+public:
+  CollisionArrays();
+
+  /** Appends an entry and returns its slot. */
+  uint32_t add(uint8_t group, const Rectf& bbox, const Vector& movement);
+
+  /** Removes the entry in the given slot, the last entry is moved
+      into it. */
+  void remove(uint32_t slot);
+
+  inline size_t size() const { return m_bbox.size(); }
+
+  inline const Rectf& get_bbox(uint32_t slot) const { return m_bbox[slot]; }
+  inline const Rectf& get_dest(uint32_t slot) const { return m_dest[slot]; }
+  inline const Vector& get_movement(uint32_t slot) const { return m_movement[slot]; }
+  inline uint8_t get_group(uint32_t slot) const { return m_group[slot]; }
+
+  /** Sets the bounding box and destination of an entry. Outside of a
+      step, its grid entry is moved along. */
+  void set_bbox(uint32_t slot, const Rectf& bbox, const Rectf& dest);
+
+  inline void set_dest(uint32_t slot, const Rectf& dest) { m_dest[slot] = dest; }
+  inline void set_movement(uint32_t slot, const Vector& movement) { m_movement[slot] = movement; }
+  inline void set_group(uint32_t slot, uint8_t group) { m_group[slot] = group; }
+  inline void set_valid(uint32_t slot, bool valid) { m_valid[slot] = valid; }
+
+  /** Returns true if the entry is in one of the collision groups of
+      the mask and was valid at the start of the step. */
+  inline bool is_selected(uint32_t slot, uint8_t colgroups) const
+  {
+    return ((1 << m_group[slot]) & colgroups) && m_valid[slot];
+  }
+
+  /** Starts a step: limits the movement of all entries to max_speed,
+      moves their destinations from the bounding boxes by it and fills
+      the grid with the destinations. */
+  void begin_update(float max_speed);
+
+  /** Moves the grid entry of the given slot to its destination, if
+      that changed since it was inserted. Returns true if it did. */
+  bool update_broadphase(uint32_t slot);
+
+  /** Ends a step: the destinations become the bounding boxes, the
+      movement is reset and the grid is left holding the new bounding
+      boxes. */
+  void end_update();
+
+  /** Makes sure the grid holds the bounding boxes of all entries, so
+      that it can be used for queries outside of a step. */
+  void update_index();
+
+  /** Marks the spatial index as out of date, it is rebuilt on the
+      next update_index(). For changes to many entries at once. */
+  inline void invalidate_index() { m_index_dirty = true; }
+
+  inline const CollisionGrid& get_grid() const { return m_grid; }
+
+private:
+  /** Fills the grid with the rectangles in m_grid_rects. */
+  void fill_grid();
+
+private:
+  std::vector<Rectf> m_bbox;
+  std::vector<Rectf> m_dest;
+  std::vector<Vector> m_movement;
+  std::vector<uint8_t> m_group;
+
+  /** Taken at the start of a step by the owner, objects can only
+      become invalid during a step. */
+  std::vector<uint8_t> m_valid;
+
+  /** The grid holds the slots at the rectangles stored in
+      m_grid_rects: the destinations during a step, the bounding boxes
+      otherwise. */
+  CollisionGrid m_grid;
+  std::vector<Rectf> m_grid_rects;
+  bool m_index_dirty;
+
+  /** True between begin_update() and end_update() */
+  bool m_updating;
+
+private:
+  CollisionArrays(const CollisionArrays&) = delete;
+  CollisionArrays& operator=(const CollisionArrays&) = delete;
+};
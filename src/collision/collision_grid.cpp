@@ -0,0 +1,195 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/collision_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/** Upper limit for the amount of cells, the cell size is increased
+    if the bounds would need more. */
+const int MAX_CELLS = 1 << 16;
+
+/** Rectangles are padded by this amount, so that touching and
+    almost touching entries are reported as well. */
+const float CELL_PADDING = 1.0f;
+
+} // namespace
+
+CollisionGrid::CollisionGrid(float cell_size) :
+  m_base_cell_size(cell_size),
+  m_cell_size(cell_size),
+  m_origin_x(0.0f),
+  m_origin_y(0.0f),
+  m_width(1),
+  m_height(1),
+  m_cells(1),
+  m_cell_stamps(1),
+  m_size(0),
+  m_stamp(0)
+{
+}
+
+void
+CollisionGrid::reset(const Rectf& bounds)
+{
+  m_cell_size = m_base_cell_size;
+  m_origin_x = std::isfinite(bounds.get_left()) ? bounds.get_left() : 0.0f;
+  m_origin_y = std::isfinite(bounds.get_top()) ? bounds.get_top() : 0.0f;
+
+  const float width = std::isfinite(bounds.get_width()) ? std::max(bounds.get_width(), 0.0f) : 0.0f;
+  const float height = std::isfinite(bounds.get_height()) ? std::max(bounds.get_height(), 0.0f) : 0.0f;
+
+  while (true)
+  {
+    m_width = static_cast<int>(width / m_cell_size) + 1;
+    m_height = static_cast<int>(height / m_cell_size) + 1;
+    if (static_cast<int64_t>(m_width) * static_cast<int64_t>(m_height) <= MAX_CELLS)
+      break;
+    m_cell_size *= 2.0f;
+  }
+
+  // Keep the allocated cells around, the grid is rebuilt every frame.
+  const size_t cell_count = static_cast<size_t>(m_width * m_height);
+  if (m_cells.size() < cell_count)
+    m_cells.resize(cell_count);
+  for (auto& cell : m_cells)
+    cell.clear();
+
+  m_stamp += 1;
+  m_cell_stamps.assign(m_cells.size(), m_stamp);
+
+  m_size = 0;
+}
+
+int
+CollisionGrid::to_cell(float pos, float origin, int count, bool upper) const
+{
+  const float cell = std::floor((pos - origin) / m_cell_size);
+
+  // NaN covers the whole grid, as Rectf::overlaps() would match everything.
+  if (std::isnan(cell))
+    return upper ? count - 1 : 0;
+  if (cell < 0.0f)
+    return 0;
+  if (cell > static_cast<float>(count - 1))
+    return count - 1;
+  return static_cast<int>(cell);
+}
+
+CollisionGrid::CellRange
+CollisionGrid::get_cells(const Rectf& rect) const
+{
+  return { to_cell(rect.get_left() - CELL_PADDING, m_origin_x, m_width, false),
+           to_cell(rect.get_top() - CELL_PADDING, m_origin_y, m_height, false),
+           to_cell(rect.get_right() + CELL_PADDING, m_origin_x, m_width, true),
+           to_cell(rect.get_bottom() + CELL_PADDING, m_origin_y, m_height, true) };
+}
+
+void
+CollisionGrid::insert(uint32_t id, const Rectf& rect)
+{
+  m_stamp += 1;
+
+  const CellRange range = get_cells(rect);
+  for (int y = range.top; y <= range.bottom; ++y)
+  {
+    for (int x = range.left; x <= range.right; ++x)
+    {
+      m_cells[y * m_width + x].push_back(id);
+      m_cell_stamps[y * m_width + x] = m_stamp;
+    }
+  }
+
+  m_size += 1;
+}
+
+void
+CollisionGrid::remove(uint32_t id, const Rectf& rect)
+{
+  m_stamp += 1;
+
+  const CellRange range = get_cells(rect);
+  for (int y = range.top; y <= range.bottom; ++y)
+  {
+    for (int x = range.left; x <= range.right; ++x)
+    {
+      auto& cell = m_cells[y * m_width + x];
+      auto it = std::find(cell.begin(), cell.end(), id);
+      if (it != cell.end())
+      {
+        *it = cell.back();
+        cell.pop_back();
+      }
+      m_cell_stamps[y * m_width + x] = m_stamp;
+    }
+  }
+
+  m_size -= 1;
+}
+
+void
+CollisionGrid::move(uint32_t id, const Rectf& old_rect, const Rectf& new_rect)
+{
+  const CellRange old_range = get_cells(old_rect);
+  const CellRange new_range = get_cells(new_rect);
+  if (old_range.left == new_range.left && old_range.top == new_range.top &&
+      old_range.right == new_range.right && old_range.bottom == new_range.bottom)
+    return;
+
+  remove(id, old_rect);
+  insert(id, new_rect);
+}
+
+void
+CollisionGrid::query(const Rectf& rect, std::vector<uint32_t>& result) const
+{
+  result.clear();
+
+  const CellRange range = get_cells(rect);
+  for (int y = range.top; y <= range.bottom; ++y)
+  {
+    for (int x = range.left; x <= range.right; ++x)
+    {
+      const auto& cell = m_cells[y * m_width + x];
+      result.insert(result.end(), cell.begin(), cell.end());
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+bool
+CollisionGrid::changed_since(const Rectf& rect, uint64_t stamp) const
+{
+  const CellRange range = get_cells(rect);
+  for (int y = range.top; y <= range.bottom; ++y)
+    for (int x = range.left; x <= range.right; ++x)
+      if (m_cell_stamps[y * m_width + x] > stamp)
+        return true;
+
+  return false;
+}
+
+void
+CollisionGrid::query(const Vector& center, float radius, std::vector<uint32_t>& result) const
+{
+  query(Rectf(center.x - radius, center.y - radius,
+              center.x + radius, center.y + radius), result);
+}
@@ -0,0 +1,123 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <stdint.h>
+#include <vector>
+
+#include "math/rectf.hpp"
+
+/**
+ * Uniform grid used as the broadphase of the CollisionSystem.
+ *
+ * Entries are identified by an id chosen by the owner (the index of
+ * the object in the CollisionSystem). The grid only answers which
+ * entries are *possibly* close to a rectangle, the caller is expected
+ * to do the exact test itself.
+ *
+ * Rectangles outside of the bounds given to reset() are clamped onto
+ * the border cells, so no entry is ever lost.
+ */
+class CollisionGrid final
+{
+public:
+  CollisionGrid(float cell_size = 128.0f);
+
+  /** Removes all entries and fits the grid to the given bounds. */
+  void reset(const Rectf& bounds);
+
+  void insert(uint32_t id, const Rectf& rect);
+  void remove(uint32_t id, const Rectf& rect);
+  void move(uint32_t id, const Rectf& old_rect, const Rectf& new_rect);
+
+  /** Stores the ids of all entries that are close to the given
+      rectangle in result. The ids are sorted in ascending order and
+      contain no duplicates, so iterating them preserves the order in
+      which the owner stores its objects. */
+  void query(const Rectf& rect, std::vector<uint32_t>& result) const;
+
+  /** Same as query(), for all entries that are close to the circle
+      with the given center and radius. */
+  void query(const Vector& center, float radius, std::vector<uint32_t>& result) const;
+
+  /** Calls func with the ids of the entries close to the given
+      rectangle, until func returns true. Ids may be visited more than
+      once and in no particular order, but nothing is allocated. */
+  template<typename F>
+  bool any_of(const Rectf& rect, F func) const
+  {
+    const CellRange range = get_cells(rect);
+    for (int y = range.top; y <= range.bottom; ++y)
+      for (int x = range.left; x <= range.right; ++x)
+        for (const uint32_t id : m_cells[y * m_width + x])
+          if (func(id))
+            return true;
+
+    return false;
+  }
+
+  /** Returns the ids of the entries close to cell (x, y). Cells
+      outside of the grid are clamped onto the border cells, which
+      also hold the entries outside of the bounds. */
+  inline const std::vector<uint32_t>& get_cell(int x, int y) const
+  {
+    return m_cells[std::clamp(y, 0, m_height - 1) * m_width + std::clamp(x, 0, m_width - 1)];
+  }
+
+  inline float get_cell_size() const { return m_cell_size; }
+  inline Vector get_origin() const { return Vector(m_origin_x, m_origin_y); }
+
+  inline size_t size() const { return m_size; }
+
+  /** Returns a stamp that increases with every change of the grid. */
+  inline uint64_t get_stamp() const { return m_stamp; }
+
+  /** Returns true if a cell close to the given rectangle changed after
+      the given stamp was taken, i.e. if query() could give a different
+      result than it did then. */
+  bool changed_since(const Rectf& rect, uint64_t stamp) const;
+
+private:
+  struct CellRange
+  {
+    int left;
+    int top;
+    int right;
+    int bottom;
+  };
+
+private:
+  CellRange get_cells(const Rectf& rect) const;
+  int to_cell(float pos, float origin, int count, bool upper) const;
+
+private:
+  float m_base_cell_size;
+  float m_cell_size;
+  float m_origin_x;
+  float m_origin_y;
+  int m_width;
+  int m_height;
+  std::vector<std::vector<uint32_t>> m_cells;
+  std::vector<uint64_t> m_cell_stamps;
+  size_t m_size;
+  uint64_t m_stamp;
+
+private:
+  CollisionGrid(const CollisionGrid&) = delete;
+  CollisionGrid& operator=(const CollisionGrid&) = delete;
+};
@@ -18,18 +18,22 @@
 #include "collision/collision_object.hpp"
 
 #include "collision/collision_movement_manager.hpp"
+#include "collision/collision_system.hpp"
 #include "supertux/moving_object.hpp"
 
 CollisionObject::CollisionObject(CollisionGroup group, MovingObject& parent) :
   m_parent(parent),
+  m_collision_system(nullptr),
+  m_slot(0),
   m_bbox(),
-  m_group(group),
   m_physic_hint(nullptr),
+  m_group(group),
   m_movement(0.0f, 0.0f),
   m_dest(),
   m_unisolid(false),
   m_pressure(),
   m_objects_hit_bottom(),
+  m_objects_hit_by_bottom(),
   m_ground_movement_manager(nullptr)
 {
 }
@@ -64,19 +68,33 @@ CollisionObject::collision_moving_object_bottom(CollisionObject& other)
   if (m_group == COLGROUP_STATIC
     || m_group == COLGROUP_MOVING_STATIC)
   {
-    m_objects_hit_bottom.insert(&other);
+    if (m_objects_hit_bottom.insert(&other).second)
+      other.m_objects_hit_by_bottom.insert(this);
   }
 }
 
 void
 CollisionObject::notify_object_removal(CollisionObject* other)
 {
-  m_objects_hit_bottom.erase(other);
+  if (m_objects_hit_bottom.erase(other))
+    other->m_objects_hit_by_bottom.erase(this);
+}
+
+void
+CollisionObject::clear_references()
+{
+  for (CollisionObject* other_object : m_objects_hit_by_bottom)
+    other_object->m_objects_hit_bottom.erase(this);
+  m_objects_hit_by_bottom.clear();
+
+  clear_bottom_collision_list();
 }
 
 void
 CollisionObject::clear_bottom_collision_list()
 {
+  for (CollisionObject* other_object : m_objects_hit_bottom)
+    other_object->m_objects_hit_by_bottom.erase(this);
   m_objects_hit_bottom.clear();
 }
 
@@ -96,6 +114,28 @@ CollisionObject::set_physic_hint(Physic& physic)
   m_physic_hint = &physic;
 }
 
+void
+CollisionObject::set_group(CollisionGroup group)
+{
+  m_group = group;
+  if (m_collision_system)
+    m_collision_system->update_group(*this);
+}
+
+void
+CollisionObject::bbox_changed()
+{
+  if (m_collision_system)
+    m_collision_system->update_bbox(*this);
+}
+
+void
+CollisionObject::movement_changed()
+{
+  if (m_collision_system)
+    m_collision_system->update_movement(*this);
+}
+
 bool
 CollisionObject::is_valid() const
 {
@@ -26,6 +26,7 @@
 #include "math/rectf.hpp"
 
 class CollisionGroundMovementManager;
+class CollisionSystem;
 class MovingObject;
 class Physic;
 
@@ -33,6 +34,10 @@ class CollisionObject
 {
   friend class CollisionSystem;
 
+  // The editor changes the bounding box in place, see bbox_changed().
+  friend class MovingObject;
+  friend class ResizeMarker;
+
 public:
   CollisionObject(CollisionGroup group, MovingObject& parent);
 
@@ -55,6 +60,9 @@ public:
 
   void notify_object_removal(CollisionObject* other);
 
+  /** removes all references that other objects hold to this object */
+  void clear_references();
+
   inline void set_ground_movement_manager(const std::shared_ptr<CollisionGroundMovementManager>& movement_manager)
   {
     m_ground_movement_manager = movement_manager;
@@ -74,6 +82,7 @@ public:
   inline void set_movement(const Vector& movement)
   {
     m_movement = movement;
+    movement_changed();
   }
 
   void propagate_movement(const Vector& movement);
@@ -90,6 +99,15 @@ public:
   {
     m_dest.move(pos - get_pos());
     m_bbox.set_pos(pos);
+    bbox_changed();
+  }
+
+  /** moves the bounding box by the given distance, without touching
+      the anticipated destination. */
+  inline void move(const Vector& dist)
+  {
+    m_bbox.move(dist);
+    bbox_changed();
   }
 
   inline Vector get_pos() const
@@ -117,6 +135,17 @@ public:
   {
     m_dest.set_width(w);
     m_bbox.set_width(w);
+    bbox_changed();
+  }
+
+  /** sets the moving object's bbox to a specific height. Be careful
+      when using this function. There are no collision detection
+      checks performed here so bad things could happen. */
+  void set_height(float h)
+  {
+    m_dest.set_height(h);
+    m_bbox.set_height(h);
+    bbox_changed();
   }
 
   /** sets the moving object's bbox to a specific size. Be careful
@@ -126,6 +155,7 @@ public:
   {
     m_dest.set_size(w, h);
     m_bbox.set_size(w, h);
+    bbox_changed();
   }
 
   void set_physic_hint(Physic& physic);
@@ -135,27 +165,42 @@ public:
     return m_group;
   }
 
+  void set_group(CollisionGroup group);
+
   bool is_valid() const;
 
   inline MovingObject& get_parent() { return m_parent; }
 
+private:
+  /** Let the CollisionSystem copy the changed state of this object. */
+  void bbox_changed();
+  void movement_changed();
+
 private:
   MovingObject& m_parent;
 
-public:
+  /** The CollisionSystem this object has been added to, if any */
+  CollisionSystem* m_collision_system;
+
+  /** The index of this object in the object list of m_collision_system */
+  uint32_t m_slot;
+
   /** The bounding box of the object (as used for collision detection,
-      this isn't necessarily the bounding box for graphics) */
+      this isn't necessarily the bounding box for graphics). Only
+      changed through the setters above, so that the copy in the
+      CollisionSystem is kept up to date. */
   Rectf m_bbox;
 
-  /** The collision group */
-  CollisionGroup m_group;
-
+public:
   /** A physics hint, which provides collision handling with additional info
       that may fix oddities. (i.e. checking if velocity is >1). Not to be
       solely relied on, as it can be null. */
   Physic* m_physic_hint;
 
 private:
+  /** The collision group */
+  CollisionGroup m_group;
+
   /** The movement that will happen till next frame */
   Vector m_movement;
 
@@ -181,6 +226,10 @@ private:
       if this object was static or moving static. */
   std::unordered_set<CollisionObject*> m_objects_hit_bottom;
 
+  /** Objects that have this object in their m_objects_hit_bottom list,
+      so that only they need to be notified when this object is removed. */
+  std::unordered_set<CollisionObject*> m_objects_hit_by_bottom;
+
   std::shared_ptr<CollisionGroundMovementManager> m_ground_movement_manager;
 
 private:
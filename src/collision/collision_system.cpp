@@ -17,28 +17,86 @@
 
 #include "collision/collision_system.hpp"
 
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <iterator>
+#include <ostream>
+
+#include <SDL3/SDL.h>
+#include <fmt/format.h>
+
 #include "collision/collision.hpp"
 #include "collision/collision_movement_manager.hpp"
+#include "collision/raycast.hpp"
 #include "editor/editor.hpp"
 #include "math/aatriangle.hpp"
 #include "math/rect.hpp"
 #include "object/player.hpp"
 #include "object/tilemap.hpp"
 #include "supertux/constants.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/resources.hpp"
 #include "supertux/sector.hpp"
 #include "supertux/tile.hpp"
+#include "util/thread_pool.hpp"
 #include "video/color.hpp"
 #include "video/drawing_context.hpp"
+#include "video/font.hpp"
+#include "video/layer.hpp"
 
 namespace
 {
   const float MAX_SPEED = 16.0f;
+
+  /** Masks of collision groups, as used by CollisionSystem::is_selected(). */
+  const uint8_t MOVING_GROUPS = (1 << COLGROUP_MOVING) | (1 << COLGROUP_MOVING_STATIC);
+  const uint8_t MOVING_GROUPS_AND_ONLY_STATIC = MOVING_GROUPS | (1 << COLGROUP_MOVING_ONLY_STATIC);
+  const uint8_t STATIC_GROUPS = (1 << COLGROUP_STATIC) | (1 << COLGROUP_MOVING_STATIC);
+  const uint8_t TOUCHABLE_GROUPS = (1 << COLGROUP_TOUCHABLE);
+
+  /** Below this amount of objects, the candidates aren't worth
+      handing to the worker threads. */
+  const size_t PARALLEL_MIN_OBJECTS = 64;
+
+  ThreadPool& get_thread_pool()
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  const char* const COLGROUP_NAMES[] = {
+    "disabled", "moving-static", "moving", "moving-only-static", "static", "touchable"
+  };
+
+  /** Returns the milliseconds since the given SDL_GetTicksNS() value
+      and sets it to the current time. */
+  float lap(Uint64& ticks)
+  {
+    const Uint64 now = SDL_GetTicksNS();
+    const float milliseconds = static_cast<float>(now - ticks) / 1000000.0f;
+    ticks = now;
+    return milliseconds;
+  }
 } // namespace
 
 CollisionSystem::CollisionSystem(Sector& sector) :
   m_sector(sector),
   m_objects(),
-  m_ground_movement_manager(new CollisionGroundMovementManager)
+  m_arrays(),
+  m_updating(false),
+  m_candidates(),
+  m_static_candidates(),
+  m_prefetched_candidates(),
+  m_prefetched_rects(),
+  m_prefetched(),
+  m_prefetch_stamp(0),
+  m_static_prefetch(),
+  m_static_prefetched(),
+  m_static_prefetch_stamp(0),
+  m_ground_movement_manager(new CollisionGroundMovementManager),
+  m_stats()
 {
 }
 
@@ -46,25 +104,173 @@ void
 CollisionSystem::add(CollisionObject* object)
 {
   object->set_ground_movement_manager(m_ground_movement_manager);
+  object->m_collision_system = this;
+  object->m_slot = m_arrays.add(static_cast<uint8_t>(object->get_group()),
+                                object->get_bbox(), object->get_movement());
+  m_arrays.set_valid(object->m_slot, object->is_valid());
   m_objects.push_back(object);
 }
 
 void
 CollisionSystem::remove(CollisionObject* object)
 {
-  m_objects.erase(
-    std::find(m_objects.begin(), m_objects.end(),
-      object));
+  // Move the last object into the slot of the removed one.
+  const uint32_t slot = object->m_slot;
+  assert(slot < m_objects.size() && m_objects[slot] == object);
+  m_arrays.remove(slot);
+  m_objects[slot] = m_objects.back();
+  m_objects[slot]->m_slot = slot;
+  m_objects.pop_back();
+
+  object->m_collision_system = nullptr;
+  object->clear_references();
 
-  // FIXME: This is a patch. A better way of fixing this is coming.
-  for (auto* collision_object : m_objects) {
-    collision_object->notify_object_removal(object);
-  }
   for (auto* tilemap : m_sector.get_solid_tilemaps()) {
     tilemap->notify_object_removal(object);
   }
 }
 
+void
+CollisionSystem::prefetch_candidates()
+{
+  const size_t count = m_objects.size();
+  m_prefetched.assign(count, false);
+  m_prefetched_rects.resize(count);
+  if (m_prefetched_candidates.size() < count)
+    m_prefetched_candidates.resize(count);
+  const CollisionGrid& grid = m_arrays.get_grid();
+  m_prefetch_stamp = grid.get_stamp();
+
+  // The workers only read the grid and the objects.
+  get_thread_pool().parallel_for(count, [this, &grid](size_t begin, size_t end) {
+    for (uint32_t i = static_cast<uint32_t>(begin); i < end; ++i) {
+      if (!is_selected(i, MOVING_GROUPS))
+        continue;
+
+      m_prefetched_rects[i] = m_arrays.get_dest(i);
+      grid.query(m_prefetched_rects[i], m_prefetched_candidates[i]);
+      m_prefetched[i] = true;
+    }
+  });
+}
+
+void
+CollisionSystem::prefetch_static_constraints()
+{
+  const size_t count = m_objects.size();
+  m_static_prefetched.assign(count, false);
+  if (m_static_prefetch.size() < count)
+    m_static_prefetch.resize(count);
+
+  const CollisionGrid& grid = m_arrays.get_grid();
+  m_static_prefetch_stamp = grid.get_stamp();
+
+  // The workers only read the grid and the objects.
+  get_thread_pool().parallel_for(count, [this, &grid](size_t begin, size_t end) {
+    for (uint32_t i = static_cast<uint32_t>(begin); i < end; ++i) {
+      if (!is_selected(i, MOVING_GROUPS_AND_ONLY_STATIC))
+        continue;
+
+      StaticPrefetch& prefetch = m_static_prefetch[i];
+      prefetch.dest = m_arrays.get_dest(i);
+      prefetch.movement = m_arrays.get_movement(i);
+      prefetch.pairs.clear();
+      grid.query(prefetch.dest, prefetch.candidates);
+
+      // Part 1 starts with the vertical movement, then takes the full
+      // movement, see collision_static_constrains().
+      const Vector vertical_movement(0.0f, prefetch.movement.y);
+      for (const uint32_t index : prefetch.candidates) {
+        if (index == i || !is_selected(index, STATIC_GROUPS))
+          continue;
+
+        StaticPair pair;
+        pair.index = index;
+        pair.rect = m_arrays.get_dest(index);
+        pair.state = get_pair_state(m_objects[i], m_objects[index]);
+        if (!collision::rectangle_rectangle_constraints(&pair.vertical, vertical_movement,
+                                                        prefetch.dest, pair.rect, pair.state))
+          continue;
+
+        collision::rectangle_rectangle_constraints(&pair.full, prefetch.movement,
+                                                   prefetch.dest, pair.rect, pair.state);
+        prefetch.pairs.push_back(pair);
+      }
+      m_static_prefetched[i] = true;
+    }
+  });
+}
+
+const CollisionSystem::StaticPrefetch*
+CollisionSystem::get_static_prefetch(uint32_t index, const Vector& movement, const Rectf& dest,
+                                     bool& vertical) const
+{
+  if (index >= m_static_prefetched.size() || !m_static_prefetched[index])
+    return nullptr;
+
+  const StaticPrefetch& prefetch = m_static_prefetch[index];
+  if (dest != prefetch.dest ||
+      m_arrays.get_grid().changed_since(dest, m_static_prefetch_stamp))
+    return nullptr;
+
+  if (movement == prefetch.movement)
+    vertical = false;
+  else if (movement == Vector(0.0f, prefetch.movement.y))
+    vertical = true;
+  else
+    return nullptr;
+
+  return &prefetch;
+}
+
+const std::vector<uint32_t>&
+CollisionSystem::get_candidates(uint32_t index)
+{
+  const Rectf& dest = m_arrays.get_dest(index);
+  if (index < m_prefetched.size() && m_prefetched[index] &&
+      dest == m_prefetched_rects[index] &&
+      !m_arrays.get_grid().changed_since(dest, m_prefetch_stamp))
+    return m_prefetched_candidates[index];
+
+  m_arrays.get_grid().query(dest, m_candidates);
+  return m_candidates;
+}
+
+bool
+CollisionSystem::is_selected(uint32_t index, uint8_t colgroups) const
+{
+  return m_arrays.is_selected(index, colgroups) && m_objects[index]->is_valid();
+}
+
+void
+CollisionSystem::update_group(const CollisionObject& object)
+{
+  assert(object.m_collision_system == this);
+  m_arrays.set_group(object.m_slot, static_cast<uint8_t>(object.get_group()));
+}
+
+void
+CollisionSystem::update_bbox(const CollisionObject& object)
+{
+  assert(object.m_collision_system == this);
+  m_arrays.set_bbox(object.m_slot, object.m_bbox, object.m_dest);
+}
+
+void
+CollisionSystem::update_movement(const CollisionObject& object)
+{
+  assert(object.m_collision_system == this);
+  m_arrays.set_movement(object.m_slot, object.m_movement);
+}
+
+void
+CollisionSystem::move_dest(uint32_t index, const Vector& dist)
+{
+  CollisionObject* object = m_objects[index];
+  object->m_dest.move(dist);
+  m_arrays.set_dest(index, object->m_dest);
+}
+
 void
 CollisionSystem::draw(DrawingContext& context)
 {
@@ -105,127 +311,95 @@ CollisionSystem::draw(DrawingContext& context)
   }
 }
 
-namespace {
-
-  collision::Constraints check_collisions(const Vector& obj_movement, const Rectf& moving_obj_rect, const Rectf& other_obj_rect,
-    CollisionObject* moving_object = nullptr, CollisionObject* other_object = nullptr)
+void
+CollisionSystem::draw_stats(DrawingContext& context) const
+{
+  std::vector<std::string> lines;
+  lines.push_back(fmt::format("collision objects: {}", m_objects.size()));
+  for (int group = COLGROUP_MOVING_STATIC; group <= COLGROUP_TOUCHABLE; ++group)
+    lines.push_back(fmt::format("  {}: {}", COLGROUP_NAMES[group], m_stats.objects_per_group[group]));
+  lines.push_back(fmt::format("pairs: {}  hits: {}  tiles: {}",
+                              m_stats.broadphase_pairs, m_stats.narrowphase_hits, m_stats.tiles));
+  lines.push_back(fmt::format("ms: {:.2f} / {:.2f} / {:.2f} / {:.2f} / {:.2f}",
+                              m_stats.time_prepare, m_stats.time_static, m_stats.time_tile_attributes,
+                              m_stats.time_touchable, m_stats.time_moving));
+
+  Vector pos(16.0f, 60.0f);
+  for (const auto& line : lines)
   {
-    collision::Constraints constraints;
+    context.color().draw_text(Resources::small_font, line, pos, ALIGN_LEFT, LAYER_HUD);
+    pos.y += Resources::small_font->get_height();
+  }
+}
 
-    // Slightly growing the static object's rectangle to detect a
-    // collision not only when they overlap, but also when they're
-    // adjacent or at least extremely close.
-    const Rectf grown_other_obj_rect = other_obj_rect.grown(EPSILON);
+void
+CollisionSystem::write_stats(std::ostream& out) const
+{
+  out << "collision:begin" << std::endl;
+  out << "  objects:" << m_objects.size() << std::endl;
+  for (int group = COLGROUP_DISABLED; group <= COLGROUP_TOUCHABLE; ++group)
+    out << "  group:" << COLGROUP_NAMES[group] << " count:" << m_stats.objects_per_group[group] << std::endl;
+  out << "  broadphase_pairs:" << m_stats.broadphase_pairs << std::endl;
+  out << "  narrowphase_hits:" << m_stats.narrowphase_hits << std::endl;
+  out << "  tiles:" << m_stats.tiles << std::endl;
+  out << "  time_prepare_ms:" << m_stats.time_prepare << std::endl;
+  out << "  time_static_ms:" << m_stats.time_static << std::endl;
+  out << "  time_tile_attributes_ms:" << m_stats.time_tile_attributes << std::endl;
+  out << "  time_touchable_ms:" << m_stats.time_touchable << std::endl;
+  out << "  time_moving_ms:" << m_stats.time_moving << std::endl;
+  out << "collision:end" << std::endl;
+}
 
-    if (!moving_obj_rect.overlaps(grown_other_obj_rect))
-      return constraints;
+namespace {
 
-    const CollisionHit dummy;
+  collision::RectanglePairState get_pair_state(const CollisionObject* moving_object,
+                                               const CollisionObject* other_object)
+  {
+    collision::RectanglePairState state;
+    state.moving_unisolid = moving_object && moving_object->is_unisolid();
+    if (other_object)
+    {
+      state.other_unisolid = other_object->is_unisolid();
+      state.other_moving_static = other_object->get_group() == COLGROUP_MOVING_STATIC;
+      state.other_movement_y = other_object->get_movement().y;
+    }
+    return state;
+  }
 
-    if (other_object != nullptr && moving_object != nullptr && !other_object->collides(*moving_object, dummy))
-      return constraints;
-    if (moving_object != nullptr && other_object != nullptr && !moving_object->collides(*other_object, dummy))
-      return constraints;
+  /** Runs the collision callbacks of two touching objects, given the
+      constraints the static one puts on the moving one. Returns the
+      constraints to apply. */
+  collision::Constraints apply_collision(const collision::Constraints& constraints,
+                                         CollisionObject& moving_object, CollisionObject& other_object)
+  {
+    const CollisionHit dummy;
 
-    // Calculate intersection.
-    const float itop = moving_obj_rect.get_bottom() - grown_other_obj_rect.get_top();
-    const float ibottom = grown_other_obj_rect.get_bottom() - moving_obj_rect.get_top();
-    const float ileft = moving_obj_rect.get_right() - grown_other_obj_rect.get_left();
-    const float iright = grown_other_obj_rect.get_right() - moving_obj_rect.get_left();
+    if (!other_object.collides(moving_object, dummy))
+      return collision::Constraints();
+    if (!moving_object.collides(other_object, dummy))
+      return collision::Constraints();
 
-    bool shiftout = false;
+    CollisionHit hit = constraints.hit;
+    moving_object.collision(other_object, hit);
+    std::swap(hit.left, hit.right);
+    std::swap(hit.top, hit.bottom);
+    const HitResponse& response = other_object.collision(moving_object, hit);
+    if (response == ABORT_MOVE)
+      return collision::Constraints();
 
-    if ((!other_object || !other_object->is_unisolid()) && (!moving_object || !moving_object->is_unisolid()))
-    {
-      if (fabsf(obj_movement.y) > fabsf(obj_movement.x)) {
-        if (ileft < SHIFT_DELTA) {
-          constraints.constrain_right(grown_other_obj_rect.get_left());
-          shiftout = true;
-        }
-        else if (iright < SHIFT_DELTA) {
-          constraints.constrain_left(grown_other_obj_rect.get_right());
-          shiftout = true;
-        }
-      }
-      else {
-        // Shiftout bottom/top.
-        if (itop < SHIFT_DELTA) {
-          constraints.constrain_bottom(grown_other_obj_rect.get_top());
-          shiftout = true;
-        }
-        else if (ibottom < SHIFT_DELTA) {
-          constraints.constrain_top(grown_other_obj_rect.get_bottom());
-          shiftout = true;
-        }
-      }
-    }
+    return constraints;
+  }
 
-    if (!shiftout)
-    {
-      if (other_object && other_object->is_unisolid())
-      {
-        // Constrain only on fall on top of the unisolid object.
-        if (moving_obj_rect.get_bottom() - obj_movement.y <= grown_other_obj_rect.get_top() - (other_object->get_movement().y - 5.f))
-        {
-          constraints.constrain_bottom(other_obj_rect.get_top());
-          constraints.hit.bottom = true;
-        }
-      }
-      else if (other_object && other_object->get_group() == COLGROUP_MOVING_STATIC &&
-               moving_object && moving_object->is_unisolid())
-      {
-        // Similar to the above, except... hacky?
-        // This prevents weird issues with rocks and granitos.
-        if (grown_other_obj_rect.get_top() - other_object->get_movement().y <= moving_obj_rect.get_top() - (obj_movement.y - 5.f))
-        {
-          constraints.constrain_top(moving_obj_rect.get_top());
-          constraints.hit.top = true;
-        }
-      }
-      else
-      {
-        const float vert_penetration = std::min(itop, ibottom);
-        const float horiz_penetration = std::min(ileft, iright);
-
-        if (vert_penetration < horiz_penetration)
-        {
-          if (itop < ibottom)
-          {
-            constraints.constrain_bottom(grown_other_obj_rect.get_top());
-            constraints.hit.bottom = true;
-          }
-          else
-          {
-            constraints.constrain_top(grown_other_obj_rect.get_bottom());
-            constraints.hit.top = true;
-          }
-        }
-        else
-        {
-          if (ileft < iright)
-          {
-            constraints.constrain_right(grown_other_obj_rect.get_left());
-            constraints.hit.right = true;
-          }
-          else
-          {
-            constraints.constrain_left(grown_other_obj_rect.get_right());
-            constraints.hit.left = true;
-          }
-        }
-      }
-    }
+  collision::Constraints check_collisions(const Vector& obj_movement, const Rectf& moving_obj_rect, const Rectf& other_obj_rect,
+    CollisionObject* moving_object = nullptr, CollisionObject* other_object = nullptr)
+  {
+    collision::Constraints constraints;
+    if (!collision::rectangle_rectangle_constraints(&constraints, obj_movement, moving_obj_rect, other_obj_rect,
+                                                    get_pair_state(moving_object, other_object)))
+      return constraints;
 
     if (other_object && moving_object)
-    {
-      CollisionHit hit = constraints.hit;
-      moving_object->collision(*other_object, hit);
-      std::swap(hit.left, hit.right);
-      std::swap(hit.top, hit.bottom);
-      const HitResponse& response = other_object->collision(*moving_object, hit);
-      if (response == ABORT_MOVE)
-        return collision::Constraints();
-    }
+      return apply_collision(constraints, *moving_object, *other_object);
 
     return constraints;
   }
@@ -250,53 +424,44 @@ CollisionSystem::collision_tilemap(collision::Constraints* constraints,
 
     bool hits_bottom = false;
 
-    for (int x = test_tiles.left; x < test_tiles.right; ++x)
-    {
-      for (int y = test_tiles.top; y < test_tiles.bottom; ++y)
+    // Only solid tiles are visited.
+    solids->for_each_collision_tile(test_tiles, TileMap::COLLISION_SOLID, [&](int x, int y) {
+      m_stats.tiles += 1;
+
+      const Tile& tile = solids->get_tile(x, y);
+      Rectf tile_bbox = solids->get_tile_bbox(x, y);
+
+      /* If the tile is a unisolid tile, Tile::is_solid() didn't do a
+      * thorough check. Calculate the position and (relative)
+      * movement of the object and determine whether or not the tile is
+      * solid with regard to those parameters. */
+      if (tile.is_unisolid())
       {
-        const Tile& tile = solids->get_tile(x, y);
-
-        // Skip non-solid tiles.
-        if (tile.is_solid())
-        {
-          Rectf tile_bbox = solids->get_tile_bbox(x, y);
-          bool is_relatively_solid = true;
-
-          /* If the tile is a unisolid tile, the "is_solid()" function above
-          * didn't do a thorough check. Calculate the position and (relative)
-          * movement of the object and determine whether or not the tile is
-          * solid with regard to those parameters. */
-          if (tile.is_unisolid())
-          {
-            Vector relative_movement = movement
-              - solids->get_movement(/* actual = */ true);
-
-            if (!tile.is_solid(tile_bbox, object.get_bbox(), relative_movement))
-              is_relatively_solid = false;
-          }
-
-          if (is_relatively_solid)
-          {
-            if (tile.is_slope()) { // Slope tile.
-              AATriangle triangle;
-              int slope_data = tile.get_data();
-              if (solids->get_flip() & VERTICAL_FLIP)
-                slope_data = AATriangle::vertical_flip(slope_data);
-              triangle = AATriangle(tile_bbox, slope_data);
-
-              bool triangle_hits_bottom = false;
-              collision::rectangle_aatriangle(constraints, dest, triangle, triangle_hits_bottom, &object);
-              hits_bottom |= triangle_hits_bottom;
-            }
-            else { // Normal rectangular tile.
-              collision::Constraints new_constraints = check_collisions(movement, dest, tile_bbox, nullptr, nullptr);
-              hits_bottom |= new_constraints.hit.bottom;
-              constraints->merge_constraints(new_constraints);
-            }
-          }
-        }
+        Vector relative_movement = movement
+          - solids->get_movement(/* actual = */ true);
+
+        if (!tile.is_solid(tile_bbox, object.get_bbox(), relative_movement))
+          return false;
       }
-    }
+
+      if (tile.is_slope()) { // Slope tile.
+        AATriangle triangle;
+        int slope_data = tile.get_data();
+        if (solids->get_flip() & VERTICAL_FLIP)
+          slope_data = AATriangle::vertical_flip(slope_data);
+        triangle = AATriangle(tile_bbox, slope_data);
+
+        bool triangle_hits_bottom = false;
+        collision::rectangle_aatriangle(constraints, dest, triangle, triangle_hits_bottom, &object);
+        hits_bottom |= triangle_hits_bottom;
+      }
+      else { // Normal rectangular tile.
+        collision::Constraints new_constraints = check_collisions(movement, dest, tile_bbox, nullptr, nullptr);
+        hits_bottom |= new_constraints.hit.bottom;
+        constraints->merge_constraints(new_constraints);
+      }
+      return false;
+    });
 
     if (hits_bottom)
       solids->hits_object_bottom(object);
@@ -320,22 +485,28 @@ CollisionSystem::collision_tile_attributes(const Rectf& dest, const Vector& mov)
     // For ice (only), add a little fudge to recognize tiles Tux is standing on.
     const Rect test_tiles_ice = solids->get_tiles_overlapping(Rectf(x1, y1, x2, y2 + SHIFT_DELTA));
 
-    for (int x = test_tiles.left; x < test_tiles.right; ++x) {
-      int y;
-      for (y = test_tiles.top; y < test_tiles.bottom; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
+    // Tiles without attributes add nothing to the result.
+    solids->for_each_collision_tile(test_tiles, TileMap::COLLISION_ALL, [&](int x, int y) {
+      m_stats.tiles += 1;
 
-        if (tile.is_collisionful(solids->get_tile_bbox(x, y), dest, mov)) {
-          result |= tile.get_attributes();
-        }
+      const Tile& tile = solids->get_tile(x, y);
+      if (tile.is_collisionful(solids->get_tile_bbox(x, y), dest, mov)) {
+        result |= tile.get_attributes();
       }
-      for (; y < test_tiles_ice.bottom; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
-        if (tile.is_collisionful(solids->get_tile_bbox(x, y), dest, mov)) {
-          result |= (tile.get_attributes() & Tile::ICE);
-        }
+      return false;
+    });
+
+    const Rect ice_rows(test_tiles.left, std::max(test_tiles.top, test_tiles.bottom),
+                        test_tiles.right, test_tiles_ice.bottom);
+    solids->for_each_collision_tile(ice_rows, TileMap::COLLISION_ATTRIBUTES, [&](int x, int y) {
+      m_stats.tiles += 1;
+
+      const Tile& tile = solids->get_tile(x, y);
+      if (tile.is_collisionful(solids->get_tile_bbox(x, y), dest, mov)) {
+        result |= (tile.get_attributes() & Tile::ICE);
       }
-    }
+      return false;
+    });
   }
 
   return result;
@@ -343,11 +514,11 @@ CollisionSystem::collision_tile_attributes(const Rectf& dest, const Vector& mov)
 
 /** Fills the CollisionHit and Normal vector between two intersecting rectangles. */
 void
-CollisionSystem::get_hit_normal(const CollisionObject* object1, const CollisionObject* object2,
+CollisionSystem::get_hit_normal(uint32_t index1, uint32_t index2,
   CollisionHit& hit, Vector& normal) const
 {
-  const Rectf& r1 = object1->m_dest;
-  const Rectf& r2 = object2->m_dest;
+  const Rectf& r1 = m_arrays.get_dest(index1);
+  const Rectf& r2 = m_arrays.get_dest(index2);
 
   const float itop = r1.get_bottom() - r2.get_top();
   const float ibottom = r2.get_bottom() - r1.get_top();
@@ -358,11 +529,11 @@ CollisionSystem::get_hit_normal(const CollisionObject* object1, const CollisionO
   const float horiz_penetration = std::min(ileft, iright);
 
   // Apply movement only on top collision with an unisolid object.
-  if (object1->is_unisolid() &&
-    r2.get_bottom() - object2->m_movement.y > r1.get_top())
+  if (m_objects[index1]->is_unisolid() &&
+    r2.get_bottom() - m_arrays.get_movement(index2).y > r1.get_top())
     return;
-  if (object2->is_unisolid() &&
-    r1.get_bottom() - object1->m_movement.y > r2.get_top())
+  if (m_objects[index2]->is_unisolid() &&
+    r1.get_bottom() - m_arrays.get_movement(index1).y > r2.get_top())
     return;
 
   if (vert_penetration < horiz_penetration) {
@@ -388,24 +559,26 @@ CollisionSystem::get_hit_normal(const CollisionObject* object1, const CollisionO
 }
 
 void
-CollisionSystem::collision_object(CollisionObject* object1, CollisionObject* object2) const
+CollisionSystem::collision_object(uint32_t index1, uint32_t index2)
 {
   using namespace collision;
 
   // If both objects are moving statics, that means
   // their collision callbacks have already been called.
   // We don't need to call them again.
-  if (object1->get_group() == COLGROUP_MOVING_STATIC &&
-    object2->get_group() == COLGROUP_MOVING_STATIC)
+  if (m_arrays.get_group(index1) == COLGROUP_MOVING_STATIC &&
+    m_arrays.get_group(index2) == COLGROUP_MOVING_STATIC)
     return;
 
-  const Rectf& r1 = object1->m_dest;
-  const Rectf& r2 = object2->m_dest;
-
   CollisionHit hit;
-  if (r1.overlaps(r2)) {
+  if (m_arrays.get_dest(index1).overlaps(m_arrays.get_dest(index2))) {
+    m_stats.narrowphase_hits += 1;
+
+    CollisionObject* object1 = m_objects[index1];
+    CollisionObject* object2 = m_objects[index2];
+
     Vector normal(0.0f, 0.0f);
-    get_hit_normal(object1, object2, hit, normal);
+    get_hit_normal(index1, index2, hit, normal);
 
     if (!object1->collides(*object2, hit))
       return;
@@ -422,16 +595,16 @@ CollisionSystem::collision_object(CollisionObject* object1, CollisionObject* obj
     HitResponse response2 = object2->collision(*object1, hit);
     if (response1 == CONTINUE && response2 == CONTINUE) {
       normal *= (0.5f + EPSILON);
-      object1->m_dest.move(-normal);
-      object2->m_dest.move(normal);
+      move_dest(index1, -normal);
+      move_dest(index2, normal);
     }
     else if (response1 == CONTINUE && response2 == FORCE_MOVE) {
       normal *= (1 + EPSILON);
-      object1->m_dest.move(-normal);
+      move_dest(index1, -normal);
     }
     else if (response1 == FORCE_MOVE && response2 == CONTINUE) {
       normal *= (1 + EPSILON);
-      object2->m_dest.move(normal);
+      move_dest(index2, normal);
     }
   }
 }
@@ -444,18 +617,58 @@ CollisionSystem::collision_static(collision::Constraints* constraints,
   collision_tilemap(constraints, movement, dest, object);
 
   // Collision with other (static) objects.
-  for (auto* static_object : m_objects)
+  bool vertical = false;
+  const StaticPrefetch* prefetch = get_static_prefetch(object.m_slot, movement, dest, vertical);
+  const std::vector<uint32_t>* candidates = &m_static_candidates;
+  if (prefetch)
+    candidates = &prefetch->candidates;
+  else
+    m_arrays.get_grid().query(dest, m_static_candidates);
+
+  size_t pair = 0;
+  for (const uint32_t index : *candidates)
   {
-    if ((
-      static_object->get_group() == COLGROUP_STATIC ||
-      static_object->get_group() == COLGROUP_MOVING_STATIC
-      ) &&
-      static_object->is_valid() &&
-      static_object != &object)
+    if (index != object.m_slot && is_selected(index, STATIC_GROUPS))
     {
+      m_stats.broadphase_pairs += 1;
 
-      collision::Constraints new_constraints = check_collisions(
-        movement, dest, static_object->m_dest, &object, static_object);
+      // Same test as the first one of rectangle_rectangle_constraints(),
+      // done on the arrays so that the object is only touched if it is
+      // close.
+      const Rectf static_dest = m_arrays.get_dest(index);
+      if (!dest.overlaps(static_dest.grown(EPSILON)))
+        continue;
+
+      CollisionObject* static_object = m_objects[index];
+      const collision::RectanglePairState state = get_pair_state(&object, static_object);
+
+      // Take the constraints from the workers, unless one of the
+      // objects changed since.
+      if (prefetch)
+      {
+        while (pair < prefetch->pairs.size() && prefetch->pairs[pair].index < index)
+          pair += 1;
+      }
+
+      collision::Constraints new_constraints;
+      if (prefetch && pair < prefetch->pairs.size() &&
+          prefetch->pairs[pair].index == index &&
+          prefetch->pairs[pair].rect == static_dest &&
+          prefetch->pairs[pair].state == state &&
+          prefetch->dest == dest)
+      {
+        new_constraints = vertical ? prefetch->pairs[pair].vertical : prefetch->pairs[pair].full;
+      }
+      else
+      {
+        collision::rectangle_rectangle_constraints(&new_constraints, movement, dest, static_dest, state);
+      }
+
+      new_constraints = apply_collision(new_constraints, object, *static_object);
+      m_arrays.update_broadphase(index);
+
+      if (new_constraints.has_constraints())
+        m_stats.narrowphase_hits += 1;
 
       if (new_constraints.hit.bottom)
         static_object->collision_moving_object_bottom(object);
@@ -587,6 +800,8 @@ CollisionSystem::collision_static_constrains(CollisionObject& object)
       }
     }
   }
+
+  m_arrays.set_dest(object.m_slot, dest);
 }
 
 void
@@ -601,64 +816,86 @@ CollisionSystem::update()
 
   m_ground_movement_manager->apply_all_ground_movement();
 
-  // Calculate destination positions of the objects.
-  for (const auto& object : m_objects)
-  {
-    const Vector& mov = object->get_movement();
+  m_updating = true;
 
-    // Make sure movement is never faster than MAX_SPEED.
-    if (glm::length(mov) > MAX_SPEED) {
-      object->m_movement = glm::normalize(mov) * MAX_SPEED;
-    }
+  m_stats = Stats();
+  Uint64 ticks = SDL_GetTicksNS();
+
+  // Calculate destination positions of the objects. Only candidate
+  // pairs found by the broadphase are tested below. The candidates are
+  // visited in the order of m_objects, so the order of the collision
+  // callbacks is the same as with a full scan.
+  m_arrays.begin_update(MAX_SPEED);
 
-    object->m_dest = object->get_bbox();
+  // Hand the destinations to the objects and take their validity, the
+  // passes below read the arrays and only touch the objects they test.
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i)
+  {
+    auto object = m_objects[i];
+    object->m_movement = m_arrays.get_movement(i);
+    object->m_dest = m_arrays.get_dest(i);
     object->m_pressure = Vector(0, 0);
-    object->m_dest.move(object->get_movement());
     object->clear_bottom_collision_list();
+
+    m_arrays.set_valid(i, object->is_valid());
+    m_stats.objects_per_group[m_arrays.get_group(i)] += 1;
   }
+  // The static candidates of Part 1 and the constraints they put on
+  // the moving objects can be found in parallel, the callbacks still
+  // run in the same order on this thread.
+  m_static_prefetched.clear();
+  if (g_config->parallel_collision && m_objects.size() >= PARALLEL_MIN_OBJECTS)
+    prefetch_static_constraints();
+  m_stats.time_prepare = lap(ticks);
 
   // Part 1: COLGROUP_MOVING vs COLGROUP_STATIC and tilemap.
-  for (const auto& object : m_objects) {
-    if ((object->get_group() != COLGROUP_MOVING
-      && object->get_group() != COLGROUP_MOVING_STATIC
-      && object->get_group() != COLGROUP_MOVING_ONLY_STATIC)
-      || !object->is_valid())
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i) {
+    if (!is_selected(i, MOVING_GROUPS_AND_ONLY_STATIC))
       continue;
 
-    collision_static_constrains(*object);
+    collision_static_constrains(*m_objects[i]);
+    m_arrays.update_broadphase(i);
   }
+  m_stats.time_static = lap(ticks);
 
   // Part 2: COLGROUP_MOVING vs tile attributes.
-  for (const auto& object : m_objects) {
-    if ((object->get_group() != COLGROUP_MOVING
-      && object->get_group() != COLGROUP_MOVING_STATIC
-      && object->get_group() != COLGROUP_MOVING_ONLY_STATIC)
-      || !object->is_valid())
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i) {
+    if (!is_selected(i, MOVING_GROUPS_AND_ONLY_STATIC))
       continue;
 
-    uint32_t tile_attributes = collision_tile_attributes(object->m_dest, object->get_movement());
+    uint32_t tile_attributes = collision_tile_attributes(m_arrays.get_dest(i), m_arrays.get_movement(i));
     if (tile_attributes >= Tile::FIRST_INTERESTING_FLAG) {
-      object->collision_tile(tile_attributes);
+      m_objects[i]->collision_tile(tile_attributes);
     }
   }
+  m_stats.time_tile_attributes = lap(ticks);
+
+  // The candidates of the remaining parts can be looked up in parallel,
+  // the callbacks below still run in the same order on this thread.
+  m_prefetched.clear();
+  if (g_config->parallel_collision && m_objects.size() >= PARALLEL_MIN_OBJECTS)
+    prefetch_candidates();
 
   // Part 2.5: COLGROUP_MOVING vs COLGROUP_TOUCHABLE.
-  for (const auto& object : m_objects)
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i)
   {
-    if ((object->get_group() != COLGROUP_MOVING
-      && object->get_group() != COLGROUP_MOVING_STATIC)
-      || !object->is_valid())
+    if (!is_selected(i, MOVING_GROUPS))
       continue;
 
-    for (auto& object_2 : m_objects) {
-      if (object_2->get_group() != COLGROUP_TOUCHABLE
-        || !object_2->is_valid())
+    for (const uint32_t index : get_candidates(i)) {
+      if (!is_selected(index, TOUCHABLE_GROUPS))
         continue;
 
-      if (object->m_dest.overlaps(object_2->m_dest)) {
+      m_stats.broadphase_pairs += 1;
+      if (m_arrays.get_dest(i).overlaps(m_arrays.get_dest(index))) {
+        m_stats.narrowphase_hits += 1;
+
+        auto object = m_objects[i];
+        auto object_2 = m_objects[index];
+
         Vector normal(0.0f, 0.0f);
         CollisionHit hit;
-        get_hit_normal(object, object_2, hit, normal);
+        get_hit_normal(i, index, hit, normal);
         if (!object->collides(*object_2, hit))
           continue;
         if (!object_2->collides(*object, hit))
@@ -669,48 +906,92 @@ CollisionSystem::update()
       }
     }
   }
+  m_stats.time_touchable = lap(ticks);
 
   // Part 3: COLGROUP_MOVING vs COLGROUP_MOVING.
-  for (auto i = m_objects.begin(); i != m_objects.end(); ++i)
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i)
   {
-    auto object = *i;
-
-    if (!object->is_valid() ||
-      (object->get_group() != COLGROUP_MOVING &&
-        object->get_group() != COLGROUP_MOVING_STATIC))
+    if (!is_selected(i, MOVING_GROUPS))
       continue;
 
-    for (auto i2 = i + 1; i2 != m_objects.end(); ++i2) {
-      auto object_2 = *i2;
-      if ((object_2->get_group() != COLGROUP_MOVING
-        && object_2->get_group() != COLGROUP_MOVING_STATIC)
-        || !object_2->is_valid())
+    const std::vector<uint32_t>* candidates = &get_candidates(i);
+    size_t candidate = std::upper_bound(candidates->begin(), candidates->end(), i) - candidates->begin();
+    while (candidate < candidates->size()) {
+      const uint32_t i2 = (*candidates)[candidate++];
+      if (!is_selected(i2, MOVING_GROUPS))
         continue;
 
-      collision_object(object, object_2);
+      m_stats.broadphase_pairs += 1;
+      collision_object(i, i2);
+      m_arrays.update_broadphase(i2);
+
+      // The object was pushed away, look for the remaining candidates
+      // around its new destination.
+      if (m_arrays.update_broadphase(i)) {
+        m_arrays.get_grid().query(m_arrays.get_dest(i), m_candidates);
+        candidates = &m_candidates;
+        candidate = std::upper_bound(candidates->begin(), candidates->end(), i2) - candidates->begin();
+      }
     }
   }
 
-  // Apply object movement.
-  for (auto* object : m_objects) {
-    object->m_bbox = object->m_dest;
-    object->m_movement = Vector(0, 0);
+  m_stats.time_moving = lap(ticks);
+
+  // Apply object movement. The grid now holds the new bounding boxes
+  // and can serve queries.
+  m_arrays.end_update();
+  for (uint32_t i = 0; i < static_cast<uint32_t>(m_objects.size()); ++i) {
+    m_objects[i]->m_bbox = m_arrays.get_bbox(i);
+    m_objects[i]->m_movement = Vector(0, 0);
   }
+  m_updating = false;
 }
 
-bool
-CollisionSystem::is_free_of(const Rectf& rect, uint8_t colgroups, const CollisionObject* ignore_object, const bool ignore_unisolid) const
+void
+CollisionSystem::get_overlapping_objects(const Rectf& rect, uint8_t colgroups,
+                                         std::vector<CollisionObject*>& result) const
 {
-  for (const auto& object : m_objects) {
-    if (object == ignore_object) continue;
-    if (!object->is_valid()) continue;
-    if (object->is_unisolid() && ignore_unisolid) continue;
-    if ((1 << object->get_group()) & colgroups) {
-      if (rect.overlaps(object->get_bbox())) return false;
-    }
+  result.clear();
+
+  const auto overlaps = [&](const CollisionObject* object) {
+    return ((1 << object->get_group()) & colgroups) && rect.overlaps(object->get_bbox());
+  };
+
+  if (m_updating) {
+    std::copy_if(m_objects.begin(), m_objects.end(), std::back_inserter(result), overlaps);
+    return;
   }
 
-  return true;
+  m_arrays.update_index();
+
+  std::vector<uint32_t> candidates;
+  m_arrays.get_grid().query(rect, candidates);
+  for (const uint32_t index : candidates) {
+    if (((1 << m_arrays.get_group(index)) & colgroups) && rect.overlaps(m_arrays.get_bbox(index)))
+      result.push_back(m_objects[index]);
+  }
+}
+
+bool
+CollisionSystem::is_free_of(const Rectf& rect, uint8_t colgroups, const CollisionObject* ignore_object, const bool ignore_unisolid) const
+{
+  const auto blocks = [&](const CollisionObject* object) {
+    if (object == ignore_object) return false;
+    if (!object->is_valid()) return false;
+    if (object->is_unisolid() && ignore_unisolid) return false;
+    return ((1 << object->get_group()) & colgroups) && rect.overlaps(object->get_bbox());
+  };
+
+  if (m_updating)
+    return std::none_of(m_objects.begin(), m_objects.end(), blocks);
+
+  m_arrays.update_index();
+
+  return !m_arrays.get_grid().any_of(rect, [&](uint32_t index) {
+    if (!((1 << m_arrays.get_group(index)) & colgroups) || !rect.overlaps(m_arrays.get_bbox(index)))
+      return false;
+    return blocks(m_objects[index]);
+  });
 }
 
 bool
@@ -722,26 +1003,26 @@ CollisionSystem::is_free_of_tiles(const Rectf& rect, const bool ignoreUnisolid,
     // Test with all tiles in this rectangle.
     const Rect test_tiles = solids->get_tiles_overlapping(rect);
 
-    for (int x = test_tiles.left; x < test_tiles.right; ++x) {
-      for (int y = test_tiles.top; y < test_tiles.bottom; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
+    const bool blocked = solids->for_each_collision_tile(test_tiles, TileMap::get_collision_flags(tiletype), [&](int x, int y) {
+      const Tile& tile = solids->get_tile(x, y);
 
-        if (!(tile.get_attributes() & tiletype))
-          continue;
-        if (tile.is_unisolid() && ignoreUnisolid)
-          continue;
-        if (tile.is_slope()) {
-          AATriangle triangle;
-          const Rectf tbbox = solids->get_tile_bbox(x, y);
-          triangle = AATriangle(tbbox, tile.get_data());
-          Constraints constraints;
-          if (!collision::rectangle_aatriangle(&constraints, rect, triangle))
-            continue;
-        }
-        // We have a solid tile that overlaps the given rectangle.
+      if (!(tile.get_attributes() & tiletype))
+        return false;
+      if (tile.is_unisolid() && ignoreUnisolid)
         return false;
+      if (tile.is_slope()) {
+        AATriangle triangle;
+        const Rectf tbbox = solids->get_tile_bbox(x, y);
+        triangle = AATriangle(tbbox, tile.get_data());
+        Constraints constraints;
+        if (!collision::rectangle_aatriangle(&constraints, rect, triangle))
+          return false;
       }
-    }
+      // We have a solid tile that overlaps the given rectangle.
+      return true;
+    });
+    if (blocked)
+      return false;
   }
 
   return true;
@@ -777,86 +1058,64 @@ CollisionSystem::get_first_line_intersection(const Vector& line_start,
   const CollisionObject* ignore_object) const
 {
   using namespace collision;
+
   RaycastResult tileresult;
+  LineHit tile_hit;
 
   if (ignore != IGNORE_TILES)
   {
-    // Check if no tile is in the way.
-
-    const float lsx = line_start.x;
-    const float lex = line_end.x;
-    const float lsy = line_start.y;
-    const float ley = line_end.y;
-
-    const bool left = lsx > lex;
-    const bool up   = lsy > ley;
-
-    for (float test_x = lsx; left ? test_x >= lex : test_x <= lex; test_x += left ? -16.f : 16.f) { // NOLINT.
-      for (float test_y = lsy; up ? test_y >= ley : test_y <= ley; test_y += up   ? -16.f : 16.f) { // NOLINT.
-        for (const auto& solids : m_sector.get_solid_tilemaps()) {
-          const auto& test_vector = Vector(test_x, test_y);
-          if (solids->is_outside_bounds(test_vector))
-          {
-            continue;
-          }
-
-          const Tile* tile = &solids->get_tile_at(test_vector);
-
-          // FIXME: check collision with slope tiles
-          if ((tile->get_attributes() & Tile::SOLID))
-          {
-            tileresult.is_valid = true;
-            tileresult.hit = tile;
-            tileresult.box = solids->get_tile_bbox(static_cast<int>(test_vector.x / 32.f),
-                                                   static_cast<int>(test_vector.y / 32.f));
-            goto finish_tiles;
-          }
-        }
+    for (const auto& solids : m_sector.get_solid_tilemaps()) {
+      if (first_tile_intersection(line_start, line_end, *solids, tile_hit)) {
+        tileresult.is_valid = true;
+        tileresult.hit = &solids->get_tile(tile_hit.x, tile_hit.y);
+        tileresult.box = tile_hit.box;
       }
     }
   }
 
-finish_tiles:
   if (ignore == IGNORE_OBJECTS)
     return tileresult;
 
-  RaycastResult objresult;
+  const auto is_obstacle = [&](const CollisionObject* object) {
+    return object != ignore_object && object->is_valid() &&
+           (object->get_group() == COLGROUP_MOVING ||
+            object->get_group() == COLGROUP_MOVING_STATIC ||
+            object->get_group() == COLGROUP_STATIC);
+  };
 
-  // Check if no object is in the way.
-  for (const auto& object : m_objects) {
-    if (object == ignore_object) continue;
-    if (!object->is_valid()) continue;
-    if ((object->get_group() == COLGROUP_MOVING)
-      || (object->get_group() == COLGROUP_MOVING_STATIC)
-      || (object->get_group() == COLGROUP_STATIC))
-    {
-      if (intersects_line(object->get_bbox(), line_start, line_end))
-      {
+  // Objects only need to be hit before the tiles, a tie goes to the tile.
+  RaycastResult objresult;
+  LineHit obj_hit = tile_hit;
+
+  if (m_updating) {
+    for (const auto& object : m_objects) {
+      float t;
+      if (is_obstacle(object) &&
+          line_rectangle_intersection(line_start, line_end, object->get_bbox(), t) && t < obj_hit.t) {
+        obj_hit.t = t;
         objresult.is_valid = true;
         objresult.hit = object;
         objresult.box = object->get_bbox();
-        break;
       }
     }
   }
+  else {
+    m_arrays.update_index();
 
-  if (ignore == IGNORE_TILES)
-    return objresult;
-
-  if (tileresult.is_valid && objresult.is_valid)
-  {
-    float tiledist = glm::distance(tileresult.box.get_middle(), line_start);
-    float objdist = glm::distance(objresult.box.get_middle(), line_start);
-    return tiledist < objdist ? tileresult : objresult;
-  }
-  else if (tileresult.is_valid)
-    return tileresult;
-  else if (objresult.is_valid)
-    return objresult;
-  else
-  {
-    return RaycastResult();
+    const auto get_bbox = [&](uint32_t index, Rectf& bbox) {
+      if (!is_obstacle(m_objects[index]))
+        return false;
+      bbox = m_objects[index]->get_bbox();
+      return true;
+    };
+    if (first_object_intersection(line_start, line_end, m_arrays.get_grid(), get_bbox, obj_hit)) {
+      objresult.is_valid = true;
+      objresult.hit = m_objects[obj_hit.id];
+      objresult.box = obj_hit.box;
+    }
   }
+
+  return objresult.is_valid ? objresult : tileresult;
 }
 
 bool
@@ -871,10 +1130,25 @@ CollisionSystem::get_nearby_objects(const Vector& center, float max_distance) co
 {
   std::vector<CollisionObject*> ret;
 
-  for (const auto& object : m_objects) {
-    float distance = object->get_bbox().distance(center);
+  if (m_updating) {
+    for (const auto& object : m_objects) {
+      float distance = object->get_bbox().distance(center);
+      if (distance <= max_distance)
+        ret.push_back(object);
+    }
+    return ret;
+  }
+
+  m_arrays.update_index();
+
+  // The distance is measured from the middle of the bounding box, which
+  // is always inside of it, so the grid finds every object in range.
+  std::vector<uint32_t> candidates;
+  m_arrays.get_grid().query(center, max_distance, candidates);
+  for (const uint32_t index : candidates) {
+    float distance = m_arrays.get_bbox(index).distance(center);
     if (distance <= max_distance)
-      ret.push_back(object);
+      ret.push_back(m_objects[index]);
   }
 
   return ret;
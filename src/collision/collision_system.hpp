@@ -17,12 +17,16 @@
 
 #pragma once
 
+#include <array>
+#include <iosfwd>
 #include <vector>
 #include <memory>
 #include <variant>
 #include <stdint.h>
 
 #include "collision/collision.hpp"
+#include "collision/collision_arrays.hpp"
+#include "collision/collision_group.hpp"
 #include "supertux/tile.hpp"
 #include "math/fwd.hpp"
 
@@ -42,6 +46,23 @@ public:
     Rectf box = {}; /**< hitbox of tile/object */
   };
 
+  /** Counters of the last update(), for finding out which levels
+      spend too much time on collisions. */
+  struct Stats
+  {
+    std::array<int, COLGROUP_TOUCHABLE + 1> objects_per_group = {};
+    int broadphase_pairs = 0; /**< object pairs passed on to the narrow phase */
+    int narrowphase_hits = 0; /**< object pairs that collided */
+    int tiles = 0; /**< tiles with collision attributes that were tested */
+
+    /** Time spent in the parts of update(), in milliseconds */
+    float time_prepare = 0.0f; /**< destinations and broadphase */
+    float time_static = 0.0f; /**< Part 1: static objects and tiles */
+    float time_tile_attributes = 0.0f; /**< Part 2 */
+    float time_touchable = 0.0f; /**< Part 2.5 */
+    float time_moving = 0.0f; /**< Part 3 */
+  };
+
 public:
   CollisionSystem(Sector& sector);
 
@@ -51,6 +72,15 @@ public:
   /** Draw collision shapes for debugging */
   void draw(DrawingContext& context);
 
+  /** Draws the counters of the last update() on the screen */
+  void draw_stats(DrawingContext& context) const;
+
+  inline const Stats& get_stats() const { return m_stats; }
+
+  /** Writes the counters of the last update() in the same
+      "key:value" format as TextureManager::debug_print(). */
+  void write_stats(std::ostream& out) const;
+
   /** Checks for all possible collisions. And calls the
       collision_handlers, which the collision_objects provide for this
       case (or not). */
@@ -61,7 +91,19 @@ public:
     return m_ground_movement_manager;
   }
 
-  bool is_free_of(const Rectf& rect, std::uint8_t colgroups, const CollisionObject* ignore_object = nullptr, const bool ignore_unisolid = false) const;
+  /** Keep the copies of the object's state in m_arrays up to date,
+      called by the setters of CollisionObject. */
+  void update_group(const CollisionObject& object);
+  void update_bbox(const CollisionObject& object);
+  void update_movement(const CollisionObject& object);
+
+  /** Stores all objects of the given collision groups whose bounding
+      box overlaps rect in result. The order of the result is
+      unspecified, as removing objects reorders them. */
+  void get_overlapping_objects(const Rectf& rect, uint8_t colgroups,
+                               std::vector<CollisionObject*>& result) const;
+
+  bool is_free_of(const Rectf& rect, uint8_t colgroups, const CollisionObject* ignore_object = nullptr, const bool ignore_unisolid = false) const;
 
   bool is_free_of_tiles(const Rectf& rect, const bool ignoreUnisolid = false, uint32_t tiletype = Tile::SOLID) const;
   bool is_free_of_statics(const Rectf& rect, const CollisionObject* ignore_object, const bool ignoreUnisolid, uint32_t tiletype = Tile::SOLID) const;
@@ -101,20 +143,105 @@ private:
 
   uint32_t collision_tile_attributes(const Rectf& dest, const Vector& mov) const;
 
-  void collision_object(CollisionObject* object1, CollisionObject* object2) const;
+  void collision_object(uint32_t index1, uint32_t index2);
 
   void collision_static_constrains(CollisionObject& object);
 
-  void get_hit_normal(const CollisionObject* object1, const CollisionObject* object2,
+  void get_hit_normal(uint32_t index1, uint32_t index2,
                       CollisionHit& hit, Vector& normal) const;
 
+  /** Moves the destination of the object at the given index, along
+      with its copy in m_arrays. */
+  void move_dest(uint32_t index, const Vector& dist);
+
+  /** Returns true if the object at the given index is in one of the
+      collision groups of the mask and still valid. */
+  bool is_selected(uint32_t index, uint8_t colgroups) const;
+
+  /** A static object that touches the destination of a moving object,
+      with the constraints that it puts on it. */
+  struct StaticPair
+  {
+    uint32_t index;
+    Rectf rect;
+    collision::RectanglePairState state;
+    collision::Constraints vertical; /**< for the vertical movement only */
+    collision::Constraints full; /**< for the full movement */
+  };
+
+  /** The static candidates of a moving object and the pairs among them,
+      for the destination and movement it had at the start of Part 1. */
+  struct StaticPrefetch
+  {
+    Rectf dest;
+    Vector movement;
+    std::vector<uint32_t> candidates;
+    std::vector<StaticPair> pairs;
+  };
+
+  /** Looks up the static candidates of all moving objects and
+      calculates the constraints they put on them on the worker
+      threads. collision_static() uses them as long as nothing they
+      depend on has changed, and runs the callbacks in order. */
+  void prefetch_static_constraints();
+
+  /** Returns the prefetched static candidates of the object at the
+      given index if they are still valid for the given destination and
+      movement. vertical is set if the movement is the vertical part of
+      the prefetched one. */
+  const StaticPrefetch* get_static_prefetch(uint32_t index, const Vector& movement,
+                                            const Rectf& dest, bool& vertical) const;
+
+  /** Looks up the broadphase candidates of all moving objects on the
+      worker threads, see get_candidates(). */
+  void prefetch_candidates();
+
+  /** Returns the broadphase candidates around the destination of the
+      object at the given index. The prefetched candidates are used if
+      neither the destination nor the grid around it changed since, so
+      the result is always the same as that of a fresh query. */
+  const std::vector<uint32_t>& get_candidates(uint32_t index);
+
 private:
   Sector& m_sector;
 
   std::vector<CollisionObject*>  m_objects;
 
+  /** Copies of the bounding box, destination, movement, group and
+      validity of the objects, indexed like m_objects, along with the
+      broadphase grid. The setters of CollisionObject write through to
+      them, so the passes of update() can filter on them and only touch
+      the objects they test. The validity is taken at the start of
+      update(); objects can only become invalid during a step, so the
+      live state is still checked for the objects that pass. Mutable,
+      as the spatial index is brought up to date by the const queries. */
+  mutable CollisionArrays m_arrays;
+
+  /** True while update() runs, the grid holds the anticipated
+      destinations then and queries fall back to a full scan. */
+  bool m_updating;
+  std::vector<uint32_t> m_candidates;
+  std::vector<uint32_t> m_static_candidates;
+
+  /** Candidates from prefetch_candidates(), indexed like m_objects,
+      along with the destinations and the grid stamp they are for. */
+  std::vector<std::vector<uint32_t>> m_prefetched_candidates;
+  std::vector<Rectf> m_prefetched_rects;
+  std::vector<uint8_t> m_prefetched;
+  uint64_t m_prefetch_stamp;
+
+  /** Results of prefetch_static_constraints(), indexed like m_objects,
+      along with the grid stamp they are for. */
+  std::vector<StaticPrefetch> m_static_prefetch;
+  std::vector<uint8_t> m_static_prefetched;
+  uint64_t m_static_prefetch_stamp;
+
   std::shared_ptr<CollisionGroundMovementManager> m_ground_movement_manager;
 
+  /** Mutable, as some of the counters are increased by the const
+      helpers of update(). */
+  mutable Stats m_stats;
+
 private:
   CollisionSystem(const CollisionSystem&) = delete;
   CollisionSystem& operator=(const CollisionSystem&) = delete;
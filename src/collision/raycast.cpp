@@ -0,0 +1,143 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/raycast.hpp"
+
+#include <algorithm>
+#include <assert.h>
+
+#include "math/aatriangle.hpp"
+#include "math/rectf.hpp"
+
+namespace collision {
+
+namespace {
+
+/** Clips the line parameter range [t0, t1] to the slab between min and
+    max on one axis. Returns false if nothing is left. */
+bool clip_slab(float start, float dir, float min, float max, float& t0, float& t1)
+{
+  if (dir == 0.0f)
+    return start >= min && start <= max;
+
+  float t_near = (min - start) / dir;
+  float t_far = (max - start) / dir;
+  if (t_near > t_far)
+    std::swap(t_near, t_far);
+
+  t0 = std::max(t0, t_near);
+  t1 = std::min(t1, t_far);
+  return t0 <= t1;
+}
+
+bool clip_rectangle(const Vector& line_start, const Vector& line_end,
+                    const Rectf& rect, float& t0, float& t1)
+{
+  const Vector dir = line_end - line_start;
+  t0 = 0.0f;
+  t1 = 1.0f;
+  return clip_slab(line_start.x, dir.x, rect.get_left(), rect.get_right(), t0, t1) &&
+         clip_slab(line_start.y, dir.y, rect.get_top(), rect.get_bottom(), t0, t1);
+}
+
+/** Returns the rectangle spanned by the slope of the triangle, which
+    is only part of the bounding box for deformed triangles. */
+Rectf get_slope_area(const AATriangle& triangle)
+{
+  const Rectf& bbox = triangle.bbox;
+  switch (triangle.dir & AATriangle::DEFORM_MASK) {
+    case 0:
+      return bbox;
+    case AATriangle::DEFORM_BOTTOM:
+      return Rectf(bbox.get_left(), bbox.get_top() + bbox.get_height() / 2, bbox.get_right(), bbox.get_bottom());
+    case AATriangle::DEFORM_TOP:
+      return Rectf(bbox.get_left(), bbox.get_top(), bbox.get_right(), bbox.get_top() + bbox.get_height() / 2);
+    case AATriangle::DEFORM_LEFT:
+      return Rectf(bbox.get_left(), bbox.get_top(), bbox.get_left() + bbox.get_width() / 2, bbox.get_bottom());
+    case AATriangle::DEFORM_RIGHT:
+      return Rectf(bbox.get_left() + bbox.get_width() / 2, bbox.get_top(), bbox.get_right(), bbox.get_bottom());
+    default:
+      assert(false);
+      return bbox;
+  }
+}
+
+} // namespace
+
+bool line_rectangle_intersection(const Vector& line_start, const Vector& line_end,
+                                 const Rectf& rect, float& t)
+{
+  float t0, t1;
+  if (!clip_rectangle(line_start, line_end, rect, t0, t1))
+    return false;
+
+  t = t0;
+  return true;
+}
+
+bool line_aatriangle_intersection(const Vector& line_start, const Vector& line_end,
+                                  const AATriangle& triangle, float& t)
+{
+  float t0, t1;
+  if (!clip_rectangle(line_start, line_end, triangle.bbox, t0, t1))
+    return false;
+
+  // The solid part of the triangle is the part of its bounding box
+  // that lies on the inner side of the slope, see rectangle_aatriangle().
+  const Rectf area = get_slope_area(triangle);
+  Vector p1(0.0f, 0.0f);
+  Vector p2(0.0f, 0.0f);
+  switch (triangle.dir & AATriangle::DIRECTION_MASK) {
+    case AATriangle::SOUTHWEST:
+      p1 = area.p1();
+      p2 = area.p2();
+      break;
+    case AATriangle::NORTHEAST:
+      p1 = area.p2();
+      p2 = area.p1();
+      break;
+    case AATriangle::SOUTHEAST:
+      p1 = Vector(area.get_left(), area.get_bottom());
+      p2 = Vector(area.get_right(), area.get_top());
+      break;
+    case AATriangle::NORTHWEST:
+      p1 = Vector(area.get_right(), area.get_top());
+      p2 = Vector(area.get_left(), area.get_bottom());
+      break;
+    default:
+      assert(false);
+  }
+
+  // Signed distance to the slope, negative on the solid side.
+  const Vector normal(p2.y - p1.y, p1.x - p2.x);
+  const Vector dir = line_end - line_start;
+  const float d0 = glm::dot(normal, line_start + dir * t0 - p2);
+  const float d1 = glm::dot(normal, line_start + dir * t1 - p2);
+
+  if (d0 <= 0.0f)
+  {
+    t = t0;
+    return true;
+  }
+  if (d1 <= 0.0f)
+  {
+    t = t0 + (t1 - t0) * d0 / (d0 - d1);
+    return true;
+  }
+  return false;
+}
+
+} // namespace collision
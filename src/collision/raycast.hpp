@@ -0,0 +1,218 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "collision/collision_grid.hpp"
+#include "math/aatriangle.hpp"
+#include "math/rectf.hpp"
+#include "math/vector.hpp"
+#include "supertux/tile.hpp"
+#include "video/flip.hpp"
+
+namespace collision {
+
+/** The closest hit of a line found so far by first_tile_intersection()
+    and first_object_intersection(). */
+struct LineHit
+{
+  /** Fraction of the line at which the hit occurs, infinity if nothing
+      was hit. */
+  float t = std::numeric_limits<float>::infinity();
+  int x = 0; /**< position of the tile in its tilemap */
+  int y = 0;
+  uint32_t id = 0; /**< grid id of the object */
+  Rectf box = {}; /**< hitbox of the tile or object */
+};
+
+/** Calls visit(x, y) for every cell of a grid with square cells of
+    cell_size, whose cell (0, 0) starts at offset, that the line from
+    line_start to line_end passes through. The cells are visited in
+    the order the line passes them (voxel traversal after Amanatides
+    and Woo), until visit returns true.
+
+    Returns true if visit returned true. */
+template<typename F>
+bool traverse_grid(const Vector& offset, float cell_size,
+                   const Vector& line_start, const Vector& line_end, F visit)
+{
+  const Vector start = (line_start - offset) / cell_size;
+  const Vector end = (line_end - offset) / cell_size;
+  if (!std::isfinite(start.x) || !std::isfinite(start.y) ||
+      !std::isfinite(end.x) || !std::isfinite(end.y))
+    return false;
+
+  const Vector dir = end - start;
+
+  int x = static_cast<int>(std::floor(start.x));
+  int y = static_cast<int>(std::floor(start.y));
+  const int end_x = static_cast<int>(std::floor(end.x));
+  const int end_y = static_cast<int>(std::floor(end.y));
+
+  const int step_x = (dir.x > 0.0f) ? 1 : -1;
+  const int step_y = (dir.y > 0.0f) ? 1 : -1;
+
+  const float infinity = std::numeric_limits<float>::infinity();
+  const float delta_x = (dir.x != 0.0f) ? std::abs(1.0f / dir.x) : infinity;
+  const float delta_y = (dir.y != 0.0f) ? std::abs(1.0f / dir.y) : infinity;
+  float next_x = (dir.x != 0.0f) ? ((step_x > 0) ? (static_cast<float>(x + 1) - start.x) : (start.x - static_cast<float>(x))) * delta_x : infinity;
+  float next_y = (dir.y != 0.0f) ? ((step_y > 0) ? (static_cast<float>(y + 1) - start.y) : (start.y - static_cast<float>(y))) * delta_y : infinity;
+
+  // Every step moves one cell closer to the end cell, so counting the
+  // steps guards against rounding errors in next_x and next_y.
+  int steps = abs(end_x - x) + abs(end_y - y);
+  while (true)
+  {
+    if (visit(x, y))
+      return true;
+
+    if (steps-- <= 0)
+      return false;
+
+    if ((next_x < next_y && x != end_x) || y == end_y)
+    {
+      x += step_x;
+      next_x += delta_x;
+    }
+    else
+    {
+      y += step_y;
+      next_y += delta_y;
+    }
+  }
+}
+
+/** Checks whether the line from line_start to line_end passes through
+    rect. If it does, t is set to the fraction of the line at which it
+    enters rect (0 if line_start is inside of rect). */
+bool line_rectangle_intersection(const Vector& line_start, const Vector& line_end,
+                                 const Rectf& rect, float& t);
+
+/** Same as line_rectangle_intersection(), for the solid part of a
+    slope. */
+bool line_aatriangle_intersection(const Vector& line_start, const Vector& line_end,
+                                  const AATriangle& triangle, float& t);
+
+/** Finds the first solid tile of tilemap that the line from line_start
+    to line_end hits before hit.t. Slopes only block the line with
+    their solid part, taking the vertical flip of the tilemap into
+    account. TilemapT only needs the accessors of TileMap used here.
+
+    Returns true if hit was updated. */
+template<typename TilemapT>
+bool first_tile_intersection(const Vector& line_start, const Vector& line_end,
+                             const TilemapT& tilemap, LineHit& hit)
+{
+  // Only walk the part of the line that is inside of the tilemap.
+  const Rectf bbox = tilemap.get_bbox();
+  float t_enter, t_exit;
+  if (!line_rectangle_intersection(line_start, line_end, bbox, t_enter) ||
+      !line_rectangle_intersection(line_end, line_start, bbox, t_exit) ||
+      t_enter >= hit.t)
+    return false;
+
+  const Vector dir = line_end - line_start;
+  const Vector start = line_start + dir * t_enter;
+  const Vector end = line_end - dir * t_exit;
+
+  bool found = false;
+  traverse_grid(tilemap.get_offset(), 32.0f, start, end, [&](int x, int y) {
+    if (x < 0 || y < 0 || x >= tilemap.get_width() || y >= tilemap.get_height())
+      return false;
+
+    const auto& tile = tilemap.get_tile(x, y);
+    if (!(tile.get_attributes() & Tile::SOLID))
+      return false;
+
+    const Rectf tile_bbox = tilemap.get_tile_bbox(x, y);
+    float t;
+    if (tile.is_slope()) {
+      int slope_data = tile.get_data();
+      if (tilemap.get_flip() & VERTICAL_FLIP)
+        slope_data = AATriangle::vertical_flip(slope_data);
+      if (!line_aatriangle_intersection(line_start, line_end, AATriangle(tile_bbox, slope_data), t))
+        return false;
+    }
+    else if (!line_rectangle_intersection(line_start, line_end, tile_bbox, t)) {
+      return false;
+    }
+
+    // Tiles further along the line can't be hit earlier.
+    if (t < hit.t) {
+      hit.t = t;
+      hit.x = x;
+      hit.y = y;
+      hit.box = tile_bbox;
+      found = true;
+    }
+    return true;
+  });
+  return found;
+}
+
+/** Finds the first entry of grid whose bounding box the line from
+    line_start to line_end hits before hit.t. get_bbox(id, bbox) stores
+    the bounding box of the entry in bbox, or returns false to ignore
+    the entry. Only the cells that the line passes are searched, up to
+    the cell of the closest hit.
+
+    Returns true if hit was updated. */
+template<typename F>
+bool first_object_intersection(const Vector& line_start, const Vector& line_end,
+                               const CollisionGrid& grid, F get_bbox, LineHit& hit)
+{
+  const float cell_size = grid.get_cell_size();
+  const Vector origin = grid.get_origin();
+
+  bool found = false;
+  const std::vector<uint32_t>* last_cell = nullptr;
+  traverse_grid(origin, cell_size, line_start, line_end, [&](int x, int y) {
+    // Lines outside of the grid pass the same border cell many times.
+    const std::vector<uint32_t>& cell = grid.get_cell(x, y);
+    if (&cell != last_cell) {
+      last_cell = &cell;
+      for (const uint32_t id : cell) {
+        Rectf bbox;
+        float t;
+        if (get_bbox(id, bbox) &&
+            line_rectangle_intersection(line_start, line_end, bbox, t) && t < hit.t) {
+          hit.t = t;
+          hit.id = id;
+          hit.box = bbox;
+          found = true;
+        }
+      }
+    }
+
+    // Entries which are only in the cells further along the line are
+    // hit after the line left this cell.
+    const Rectf area(origin.x + static_cast<float>(x) * cell_size,
+                     origin.y + static_cast<float>(y) * cell_size,
+                     origin.x + static_cast<float>(x + 1) * cell_size,
+                     origin.y + static_cast<float>(y + 1) * cell_size);
+    float t_exit;
+    return line_rectangle_intersection(line_end, line_start, area, t_exit) &&
+           1.0f - t_exit >= hit.t;
+  });
+  return found;
+}
+
+} // namespace collision
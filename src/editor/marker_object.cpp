@@ -27,8 +27,8 @@ MarkerObject::MarkerObject (const Vector& pos)
   : arrow_surface(Surface::from_file("images/engine/editor/resize_arrow.png")),
     circle_surface(Surface::from_file("images/engine/editor/node_circle.png"))
 {
-  m_col.m_bbox.set_p1(pos);
-  m_col.m_bbox.set_size(16, 16);
+  m_col.set_pos(pos);
+  m_col.set_size(16, 16);
 }
 
 MarkerObject::MarkerObject ():
@@ -65,6 +65,6 @@ MarkerObject::draw(DrawingContext& context)
     marker_surface = arrow_surface;
   }
 
-  context.color().draw_surface(marker_surface, m_col.m_bbox.get_middle() - Vector(7, 7),
+  context.color().draw_surface(marker_surface, m_col.get_bbox().get_middle() - Vector(7, 7),
                                get_rotation(), Color::WHITE, Blend::BLEND, get_layer());
 }
@@ -102,6 +102,7 @@ ResizeMarker::move_to(const Vector& pos)
       m_rect->set_right(std::max(pos.x, m_rect->get_left() + 2));
       break;
   }
+  m_object->m_col.bbox_changed();
 
   refresh_pos();
 }
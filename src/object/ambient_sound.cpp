@@ -39,14 +39,16 @@ AmbientSound::AmbientSound(const ReaderMapping& mapping) :
   m_volume(),
   m_has_played_sound(false)
 {
-  m_col.m_group = COLGROUP_DISABLED;
+  m_col.set_group(COLGROUP_DISABLED);
 
   float w, h;
-  mapping.get("x", m_col.m_bbox.get_left(), 0.0f);
-  mapping.get("y", m_col.m_bbox.get_top(), 0.0f);
+  Vector pos(0.0f, 0.0f);
+  mapping.get("x", pos.x, 0.0f);
+  mapping.get("y", pos.y, 0.0f);
+  m_col.set_pos(pos);
   mapping.get("width" , w, 32.0f);
   mapping.get("height", h, 32.0f);
-  m_col.m_bbox.set_size(w, h);
+  m_col.set_size(w, h);
 
   mapping.get("radius", m_radius, 1.0f);
   mapping.get("sample", m_sample, "");
@@ -66,10 +68,10 @@ AmbientSound::AmbientSound(const Vector& pos, float radius, float vol, const std
   m_volume(vol),
   m_has_played_sound(false)
 {
-  m_col.m_group = COLGROUP_DISABLED;
+  m_col.set_group(COLGROUP_DISABLED);
 
-  m_col.m_bbox.set_pos(pos);
-  m_col.m_bbox.set_size(32, 32);
+  m_col.set_pos(pos);
+  m_col.set_size(32, 32);
 
   prepare_sound_source();
 }
@@ -43,7 +43,7 @@ BicyclePlatformChild::update(float dt_sec)
   float angle = m_parent.m_angle + m_angle_offset;
   angle = math::positive_fmodf(angle, math::TAU);
 
-  Vector dest = m_parent.m_center + Vector(cosf(angle), sinf(angle)) * m_parent.m_radius - (m_col.m_bbox.get_size().as_vector() * 0.5f);
+  Vector dest = m_parent.m_center + Vector(cosf(angle), sinf(angle)) * m_parent.m_radius - (m_col.get_bbox().get_size().as_vector() * 0.5f);
   Vector movement = dest - get_pos();
   m_col.set_movement(movement);
   m_col.propagate_movement(movement);
@@ -55,7 +55,7 @@ BicyclePlatformChild::collision(MovingObject& other, const CollisionHit& )
   const float gravity = Sector::get().get_gravity();
 
   // Somehow the hit parameter does not get filled in, so to determine (hit.top == true) we do this:
-  if (other.get_bbox().get_bottom() > m_col.m_bbox.get_top() + 2) return FORCE_MOVE;
+  if (other.get_bbox().get_bottom() > m_col.get_bbox().get_top() + 2) return FORCE_MOVE;
 
   auto pl = dynamic_cast<Player*>(&other);
   if (pl) {
@@ -44,7 +44,7 @@ Block::Block(const Vector& pos, const std::string& sprite_file) :
   m_bounce_offset(0),
   m_original_y(-1)
 {
-  m_col.m_bbox.set_size(32, 32.1f);
+  m_col.set_size(32, 32.1f);
   set_group(COLGROUP_STATIC);
   SoundManager::current()->preload("sounds/upgrade.wav");
   SoundManager::current()->preload("sounds/brick.wav");
@@ -58,7 +58,7 @@ Block::Block(const ReaderMapping& mapping, const std::string& sprite_file) :
   m_bounce_offset(0),
   m_original_y(-1)
 {
-  m_col.m_bbox.set_size(32, 32.1f);
+  m_col.set_size(32, 32.1f);
   set_group(COLGROUP_STATIC);
   SoundManager::current()->preload("sounds/upgrade.wav");
   SoundManager::current()->preload("sounds/brick.wav");
@@ -86,9 +86,9 @@ Block::collision(MovingObject& other, const CollisionHit& hit_)
     else if (!player->is_water_jumping() && !player->is_swimming())
     {
       bool x_coordinates_intersect =
-        player->get_bbox().get_right() >= m_col.m_bbox.get_left() &&
-        player->get_bbox().get_left() <= m_col.m_bbox.get_right();
-      if (player->get_bbox().get_top() > m_col.m_bbox.get_bottom() - SHIFT_DELTA &&
+        player->get_bbox().get_right() >= m_col.get_bbox().get_left() &&
+        player->get_bbox().get_left() <= m_col.get_bbox().get_right();
+      if (player->get_bbox().get_top() > m_col.get_bbox().get_bottom() - SHIFT_DELTA &&
           x_coordinates_intersect)
       {
         hit(*player);
@@ -103,7 +103,7 @@ Block::collision(MovingObject& other, const CollisionHit& hit_)
   auto badguy = dynamic_cast<BadGuy*> (&other);
   auto portable = dynamic_cast<Portable*> (&other);
   bool is_portable = ((portable != nullptr) && portable->is_portable());
-  bool hit_mo_from_below = other.get_bbox().get_bottom() < m_col.m_bbox.get_top() + SHIFT_DELTA;
+  bool hit_mo_from_below = other.get_bbox().get_bottom() < m_col.get_bbox().get_top() + SHIFT_DELTA;
   if (m_bouncing && (!is_portable || badguy) && hit_mo_from_below) {
 
     // Badguys get killed.
@@ -156,7 +156,7 @@ void
 Block::start_bounce(MovingObject* hitter)
 {
   if (m_original_y == -1){
-    m_original_y = m_col.m_bbox.get_top();
+    m_original_y = m_col.get_bbox().get_top();
   }
   m_bouncing = true;
   m_bounce_dir = -BOUNCY_BRICK_SPEED;
@@ -165,7 +165,7 @@ Block::start_bounce(MovingObject* hitter)
   if (!hitter) return;
 
   float center_of_hitter = hitter->get_bbox().get_middle().x;
-  float offset = (m_col.m_bbox.get_middle().x - center_of_hitter)*2 / m_col.m_bbox.get_width();
+  float offset = (m_col.get_bbox().get_middle().x - center_of_hitter)*2 / m_col.get_bbox().get_width();
 
   // Without this, hitting a multi-coin bonus block from the side (e. g. with
   // an ice block or a snail) would turn the block 90 degrees.
@@ -55,6 +55,7 @@ public:
   virtual void hit(Player& player) override;
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   static std::string class_name() { return "bonusblock"; }
   virtual std::string get_class_name() const override { return class_name(); }
@@ -56,8 +56,8 @@ Bullet::Bullet(const Vector& pos, const Vector& xm, Direction dir, BonusType typ
       break;
   }
 
-  m_col.m_bbox.set_pos(pos);
-  m_col.m_bbox.set_size(sprite->get_current_hitbox_width(), sprite->get_current_hitbox_height());
+  m_col.set_pos(pos);
+  m_col.set_size(sprite->get_current_hitbox_width(), sprite->get_current_hitbox_height());
   sprite->set_action(physic.get_velocity_x() > 0 ? "right" : "left");
 }
 
@@ -123,10 +123,16 @@ Bullet::draw(DrawingContext& context)
 {
   sprite->draw(context.color(), get_pos(), LAYER_OBJECTS);
   if (type == BONUS_FIRE){
-    lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+    lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), 0);
   }
 }
 
+float
+Bullet::get_draw_margin() const
+{
+  return add_sprite_margin(add_sprite_margin(MovingObject::get_draw_margin(), *sprite), *lightsprite);
+}
+
 void
 Bullet::collision_solid(const CollisionHit& hit)
 {
@@ -34,6 +34,7 @@ public:
 
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   virtual void collision_solid(const CollisionHit& hit) override;
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit) override;
   virtual bool is_saveable() const override { return false; }
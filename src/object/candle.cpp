@@ -91,16 +91,25 @@ Candle::draw(DrawingContext& context)
   if (burning) {
     // Vector pos = get_pos() + (bbox.get_size() - candle_light_1->get_size()) / 2;
     // draw approx. 1 in 10 frames darker. Makes the candle flicker.
-    if (graphicsRandom.rand(10) != 0 || !flicker) {
+    if (!flicker && candle_light_1->get_blend() == Blend::ADD && candle_light_1->get_frames() == 1) {
+      // A steady candle doesn't change, its light can be cached.
+      candle_light_1->draw(context.static_light(), m_col.get_bbox().get_middle(), m_layer);
+    } else if (graphicsRandom.rand(10) != 0 || !flicker) {
       // context.color().draw_surface(candle_light_1, pos, layer);
-      candle_light_1->draw(context.light(), m_col.m_bbox.get_middle(), m_layer);
+      candle_light_1->draw(context.light(), m_col.get_bbox().get_middle(), m_layer);
     } else {
       // context.color().draw_surface(candle_light_2, pos, layer);
-      candle_light_2->draw(context.light(), m_col.m_bbox.get_middle(), m_layer);
+      candle_light_2->draw(context.light(), m_col.get_bbox().get_middle(), m_layer);
     }
   }
 }
 
+float
+Candle::get_draw_margin() const
+{
+  return add_sprite_margin(add_sprite_margin(MovingSprite::get_draw_margin(), *candle_light_1), *candle_light_2);
+}
+
 HitResponse
 Candle::collision(MovingObject&, const CollisionHit& )
 {
@@ -110,7 +119,7 @@ Candle::collision(MovingObject&, const CollisionHit& )
 void
 Candle::puff_smoke()
 {
-  Vector ppos = m_col.m_bbox.get_middle();
+  Vector ppos = m_col.get_bbox().get_middle();
   Vector pspeed = Vector(0, -150);
   Vector paccel = Vector(0,0);
   Sector::get().add<SpriteParticle>("images/particles/smoke.sprite",
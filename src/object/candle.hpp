@@ -34,6 +34,7 @@ public:
 public:
   Candle(const ReaderMapping& mapping);
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit) override;
   static std::string class_name() { return "candle"; }
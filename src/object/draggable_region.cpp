@@ -38,7 +38,7 @@ DraggableRegion::DraggableRegion(Color color, const ReaderMapping &reader) :
 void
 DraggableRegion::draw_draggable_box(DrawingContext& context)
 {
-  Rectf& box = m_col.m_bbox;
+  const Rectf& box = m_col.get_bbox();
   if (Editor::is_active() && Editor::current()->get_draggables_visible())
   {
     context.color().draw_filled_rect(box, m_color, 0.0f, LAYER_OBJECTS);
@@ -29,6 +29,7 @@ public:
   Firefly(const ReaderMapping& mapping);
 
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   virtual void update(float dt_sec) override;
 
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit) override;
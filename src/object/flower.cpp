@@ -29,7 +29,7 @@ Flower::Flower(BonusType _type, const std::string& custom_sprite, int layer) :
   m_layer(layer),
   lightsprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light-small.sprite"))
 {
-  m_col.m_bbox.set_size(32, 32);
+  m_col.set_size(32, 32);
   lightsprite->set_blend(Blend::ADD);
 
   if (type == BONUS_FIRE) {
@@ -67,7 +67,13 @@ void
 Flower::draw(DrawingContext& context)
 {
   sprite->draw(context.color(), get_pos(), m_layer, flip);
-  lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+  lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), 0);
+}
+
+float
+Flower::get_draw_margin() const
+{
+  return add_sprite_margin(add_sprite_margin(MovingObject::get_draw_margin(), *sprite), *lightsprite);
 }
 
 HitResponse
@@ -62,6 +62,12 @@ GrowUp::draw(DrawingContext& context)
   m_lightsprite->draw(context.light(), get_bbox().get_middle(), 0);
 }
 
+float
+GrowUp::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *m_lightsprite);
+}
+
 void
 GrowUp::collision_solid(const CollisionHit& hit)
 {
@@ -17,6 +17,7 @@
 #include "object/infoblock.hpp"
 
 #include <algorithm>
+#include <limits>
 
 #include "editor/editor.hpp"
 #include "object/player.hpp"
@@ -139,7 +140,7 @@ InfoBlock::collision(MovingObject& other, const CollisionHit& hit_)
 Player*
 InfoBlock::get_nearest_player() const
 {
-  return Sector::get().get_nearest_player (m_col.m_bbox);
+  return Sector::get().get_nearest_player (m_col.get_bbox());
 }
 
 void
@@ -152,7 +153,7 @@ InfoBlock::update(float dt_sec)
   // hide message if player is too far away
   if (m_dest_pct > 0) {
     if (auto* player = get_nearest_player()) {
-      Vector p1 = m_col.m_bbox.get_middle();
+      Vector p1 = m_col.get_bbox().get_middle();
       Vector p2 = player->get_bbox().get_middle();
       Vector dist = (p2 - p1);
       float d = glm::length(dist);
@@ -185,8 +186,8 @@ InfoBlock::draw(DrawingContext& context)
   float border = 8;
   float width = 400; // this is the text width only
   float height = m_lines_height; // this is the text height only
-  float x1 = (m_col.m_bbox.get_left() + m_col.m_bbox.get_right())/2 - width/2;
-  float x2 = (m_col.m_bbox.get_left() + m_col.m_bbox.get_right())/2 + width/2;
+  float x1 = (m_col.get_bbox().get_left() + m_col.get_bbox().get_right())/2 - width/2;
+  float x2 = (m_col.get_bbox().get_left() + m_col.get_bbox().get_right())/2 + width/2;
   float y1 = m_initial_y;
 
   if (x1 < 0) {
@@ -232,6 +233,13 @@ InfoBlock::draw(DrawingContext& context)
   context.pop_transform();
 }
 
+float
+InfoBlock::get_draw_margin() const
+{
+  // The info box is wider than the block and is placed by the block.
+  return (m_shown_pct > 0.0f) ? std::numeric_limits<float>::infinity() : Block::get_draw_margin();
+}
+
 void
 InfoBlock::show_message()
 {
@@ -30,6 +30,7 @@ public:
 
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   static std::string class_name() { return "infoblock"; }
   virtual std::string get_class_name() const override { return class_name(); }
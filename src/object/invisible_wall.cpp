@@ -25,21 +25,23 @@ InvisibleWall::InvisibleWall(const ReaderMapping& mapping):
   width(),
   height()
 {
-  mapping.get("x", m_col.m_bbox.get_left(), 0.0f);
-  mapping.get("y", m_col.m_bbox.get_top(), 0.0f);
+  Vector pos(0.0f, 0.0f);
+  mapping.get("x", pos.x, 0.0f);
+  mapping.get("y", pos.y, 0.0f);
+  m_col.set_pos(pos);
   mapping.get("width", width, 32.0f);
   mapping.get("height", height, 32.0f);
 
-  m_col.m_bbox.set_size(width, height);
+  m_col.set_size(width, height);
 
-  m_col.m_group = COLGROUP_STATIC;
+  m_col.set_group(COLGROUP_STATIC);
 }
 
 ObjectSettings
 InvisibleWall::get_settings()
 {
-  width = m_col.m_bbox.get_width();
-  height = m_col.m_bbox.get_height();
+  width = m_col.get_bbox().get_width();
+  height = m_col.get_bbox().get_height();
 
   ObjectSettings result = MovingObject::get_settings();
 
@@ -51,7 +53,7 @@ InvisibleWall::get_settings()
 
 void
 InvisibleWall::after_editor_set() {
-  m_col.m_bbox.set_size(width, height);
+  m_col.set_size(width, height);
 }
 
 HitResponse
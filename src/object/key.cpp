@@ -187,7 +187,13 @@ Key::draw(DrawingContext& context)
     return;
 
   m_sprite->draw(context.color(), get_pos(), m_layer, m_flip);
-  m_lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), m_layer+1);
+  m_lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), m_layer+1);
+}
+
+float
+Key::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *m_lightsprite);
 }
 
 ObjectSettings
@@ -215,8 +221,8 @@ Key::after_editor_set()
 void
 Key::update_pos()
 {
-  m_col.m_bbox.set_pos(m_owner->get_bbox().get_middle() -
-    Vector(m_col.m_bbox.get_width() / 2.f, m_col.m_bbox.get_height() / 2.f - 10.f));
+  m_col.set_pos(m_owner->get_bbox().get_middle() -
+    Vector(m_col.get_bbox().get_width() / 2.f, m_col.get_bbox().get_height() / 2.f - 10.f));
 }
 
 void
@@ -31,6 +31,7 @@ public:
   virtual void update(float dt_sec) override;
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit_) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   static std::string class_name() { return "key"; }
   virtual std::string get_class_name() const override { return class_name(); }
@@ -29,7 +29,8 @@
 Lantern::Lantern(const ReaderMapping& reader) :
   Rock(reader, "images/objects/lantern/lantern.sprite"),
   lightcolor(1.0f, 1.0f, 1.0f),
-  lightsprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite"))
+  lightsprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite")),
+  last_lightpos(0.0f, 0.0f)
 {
   std::vector<float> vColor;
   if (reader.get("color", vColor)) {
@@ -47,7 +48,8 @@ Lantern::Lantern(const ReaderMapping& reader) :
 Lantern::Lantern(const Vector& pos) :
   Rock(pos, "images/objects/lantern/lantern.sprite"),
   lightcolor(0.0f, 0.0f, 0.0f),
-  lightsprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite"))
+  lightsprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite")),
+  last_lightpos(0.0f, 0.0f)
 {
   lightsprite->set_blend(Blend::ADD);
   updateColor();
@@ -91,8 +93,20 @@ void
 Lantern::draw(DrawingContext& context){
   //Draw the Sprite.
   MovingSprite::draw(context);
-  //Let there be light.
-  lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+  //Let there be light. A lantern that stayed in place since the last
+  //frame can have its light cached. The movement of the collision
+  //object is already applied and reset at this point.
+  const Vector lightpos = m_col.get_bbox().get_middle();
+  const bool at_rest = !is_grabbed() && lightpos == last_lightpos;
+  last_lightpos = lightpos;
+  lightsprite->draw(at_rest ? context.static_light() : context.light(),
+                    lightpos, 0);
+}
+
+float
+Lantern::get_draw_margin() const
+{
+  return add_sprite_margin(Rock::get_draw_margin(), *lightsprite);
 }
 
 HitResponse Lantern::collision(MovingObject& other, const CollisionHit& hit) {
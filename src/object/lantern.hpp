@@ -26,6 +26,7 @@ public:
   Lantern(const ReaderMapping& reader);
 
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit) override;
 
@@ -52,6 +53,7 @@ public:
 private:
   Color lightcolor;
   SpritePtr lightsprite;
+  Vector last_lightpos; /**< position of the light in the last frame */
   void updateColor();
 
 private:
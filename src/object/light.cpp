@@ -40,5 +40,11 @@ Light::draw(DrawingContext& context)
 {
   sprite->set_color(color);
   sprite->set_blend(Blend::ADD);
-  sprite->draw(context.light(), position, 0);
+  sprite->draw(is_steady() ? context.static_light() : context.light(), position, 0);
+}
+
+bool
+Light::is_steady() const
+{
+  return sprite->get_frames() == 1;
 }
@@ -35,6 +35,12 @@ public:
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
 
+protected:
+  /** Returns true if the light looks the same in every frame, so it
+      can be drawn with DrawingContext::static_light(). Animated
+      sprites are drawn to the lightmap every frame instead. */
+  virtual bool is_steady() const;
+
 protected:
   Vector position;
   Color color;
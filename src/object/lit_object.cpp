@@ -57,6 +57,12 @@ LitObject::draw(DrawingContext& context)
   m_light_sprite->draw(context.light(), get_pos() - m_light_offset, m_layer - 1, m_flip);
 }
 
+float
+LitObject::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *m_light_sprite) + glm::length(m_light_offset);
+}
+
 void
 LitObject::update(float)
 {
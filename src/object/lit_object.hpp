@@ -35,6 +35,7 @@ public:
   LitObject(const ReaderMapping& reader);
 
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   virtual void update(float) override;
 
   virtual HitResponse collision(MovingObject&, const CollisionHit&) override { return ABORT_MOVE; }
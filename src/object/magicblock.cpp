@@ -73,8 +73,8 @@ MagicBlock::MagicBlock(const ReaderMapping& mapping) :
     set_trigger_color();
   }
 
-  m_center = m_col.m_bbox.get_middle();
-  m_solid_box = Rectf(m_col.m_bbox.get_left() + SHIFT_DELTA, m_col.m_bbox.get_top() + SHIFT_DELTA, m_col.m_bbox.get_right() - SHIFT_DELTA, m_col.m_bbox.get_bottom() - SHIFT_DELTA);
+  m_center = m_col.get_bbox().get_middle();
+  m_solid_box = Rectf(m_col.get_bbox().get_left() + SHIFT_DELTA, m_col.get_bbox().get_top() + SHIFT_DELTA, m_col.get_bbox().get_right() - SHIFT_DELTA, m_col.get_bbox().get_bottom() - SHIFT_DELTA);
 }
 
 ObjectSettings
@@ -191,7 +191,7 @@ MagicBlock::draw(DrawingContext& context)
   context.light().get_pixel(m_center, m_light);
 
   MovingSprite::draw(context);
-  context.color().draw_filled_rect(m_col.m_bbox, m_color, m_layer);
+  context.color().draw_filled_rect(m_col.get_bbox(), m_color, m_layer);
 }
 
 bool
@@ -211,5 +211,5 @@ MagicBlock::on_flip(float height)
 {
   MovingSprite::on_flip(height);
   FlipLevelTransformer::transform_flip(m_flip);
-  m_center = m_col.m_bbox.get_middle();
+  m_center = m_col.get_bbox().get_middle();
 }
@@ -30,11 +30,13 @@ ParticleZone::ParticleZone(const ReaderMapping& reader) :
   parse_type(reader);
 
   float w,h;
-  reader.get("x", m_col.m_bbox.get_left(), 0.0f);
-  reader.get("y", m_col.m_bbox.get_top(), 0.0f);
+  Vector pos(0.0f, 0.0f);
+  reader.get("x", pos.x, 0.0f);
+  reader.get("y", pos.y, 0.0f);
+  m_col.set_pos(pos);
   reader.get("width", w, 32.0f);
   reader.get("height", h, 32.0f);
-  m_col.m_bbox.set_size(w, h);
+  m_col.set_size(w, h);
 
   reader.get("enabled", m_enabled, true);
   reader.get("particle-name", m_particle_name, "");
@@ -99,7 +101,7 @@ ParticleZone::draw(DrawingContext& context)
     DraggableRegion::draw(context);
     context.color().draw_text(Resources::small_font,
                           m_particle_name,
-                          m_col.m_bbox.p1(),
+                          m_col.get_bbox().p1(),
                           FontAlignment::ALIGN_LEFT,
                           LAYER_OBJECTS,
                           Color::WHITE);
@@ -128,9 +128,9 @@ ParticleSystem::draw(DrawingContext& context)
     auto& surface = it.first;
     auto& batch = it.second;
     context.color().draw_surface_batch(surface,
-                                       batch.move_srcrects(),
-                                       batch.move_dstrects(),
-                                       batch.move_angles(),
+                                       batch.get_srcrects(),
+                                       batch.get_dstrects(),
+                                       batch.get_angles(),
                                        batch.get_color(),
                                        z_pos);
   }
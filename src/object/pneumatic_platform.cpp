@@ -50,7 +50,7 @@ HitResponse
 PneumaticPlatformChild::collision(MovingObject& other, const CollisionHit& )
 {
   // somehow the hit parameter does not get filled in, so to determine (hit.top == true) we do this:
-  if (other.get_bbox().get_bottom() > m_col.m_bbox.get_top() + 2) return FORCE_MOVE;
+  if (other.get_bbox().get_bottom() > m_col.get_bbox().get_top() + 2) return FORCE_MOVE;
 
   auto pl = dynamic_cast<Player*>(&other);
   if (pl) {
@@ -139,8 +139,8 @@ PneumaticPlatform::update(float dt_sec)
 void
 PneumaticPlatform::on_flip(float height)
 {
-  m_pos.y = height - m_pos.y - m_children[0]->m_col.m_bbox.get_height();
-  m_start_y = height - m_start_y - m_children[0]->m_col.m_bbox.get_height();
+  m_pos.y = height - m_pos.y - m_children[0]->m_col.get_bbox().get_height();
+  m_start_y = height - m_start_y - m_children[0]->m_col.get_bbox().get_height();
 }
 
 void
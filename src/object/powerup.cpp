@@ -290,15 +290,15 @@ PowerUp::update(float dt_sec)
     case STAR:
     case HERRING:
       // Stars and herrings should sparkle when close to Tux.
-      if (auto* player = Sector::get().get_nearest_player(m_col.m_bbox))
+      if (auto* player = Sector::get().get_nearest_player(m_col.get_bbox()))
       {
-        float disp_x = player->get_bbox().get_left() - m_col.m_bbox.get_left();
-        float disp_y = player->get_bbox().get_top() - m_col.m_bbox.get_top();
+        float disp_x = player->get_bbox().get_left() - m_col.get_bbox().get_left();
+        float disp_y = player->get_bbox().get_top() - m_col.get_bbox().get_top();
         if (disp_x*disp_x + disp_y*disp_y <= 256*256)
         {
           if (graphicsRandom.rand(0, 2) == 0) {
-            float px = graphicsRandom.randf(m_col.m_bbox.get_left() * 1.0f, m_col.m_bbox.get_right() * 1.0f);
-            float py = graphicsRandom.randf(m_col.m_bbox.get_top() * 1.0f, m_col.m_bbox.get_bottom() * 1.0f);
+            float px = graphicsRandom.randf(m_col.get_bbox().get_left() * 1.0f, m_col.get_bbox().get_right() * 1.0f);
+            float py = graphicsRandom.randf(m_col.get_bbox().get_top() * 1.0f, m_col.get_bbox().get_bottom() * 1.0f);
             Vector ppos = Vector(px, py);
             Vector pspeed = Vector(0, 0);
             Vector paccel = Vector(0, 0);
@@ -336,7 +336,13 @@ PowerUp::draw(DrawingContext& context)
   if (m_type == STAR || m_type == HERRING)
     m_sprite->draw(context.color(), get_pos(), m_layer, m_flip);
 
-  lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+  lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), 0);
+}
+
+float
+PowerUp::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *lightsprite);
 }
 
 ObjectSettings
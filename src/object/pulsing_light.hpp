@@ -33,6 +33,9 @@ public:
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
 
+protected:
+  virtual bool is_steady() const override { return false; }
+
 protected:
   float min_alpha; /**< minimum alpha */
   float max_alpha; /**< maximum alpha */
@@ -62,8 +62,8 @@ ScriptedObject::ScriptedObject(const ReaderMapping& mapping) :
 ObjectSettings
 ScriptedObject::get_settings()
 {
-  new_size.x = m_col.m_bbox.get_width();
-  new_size.y = m_col.m_bbox.get_height();
+  new_size.x = m_col.get_bbox().get_width();
+  new_size.y = m_col.get_bbox().get_height();
 
   ObjectSettings result = MovingSprite::get_settings();
 
@@ -49,6 +49,7 @@ public:
 
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit_) override;
 
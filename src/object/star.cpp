@@ -44,14 +44,14 @@ Star::update(float dt_sec)
   m_col.set_movement(physic.get_movement(dt_sec));
 
   // when near Tux, spawn particles
-  if (auto* player = Sector::get().get_nearest_player (m_col.m_bbox)) {
-    float disp_x = player->get_bbox().get_left() - m_col.m_bbox.get_left();
-    float disp_y = player->get_bbox().get_top() - m_col.m_bbox.get_top();
+  if (auto* player = Sector::get().get_nearest_player (m_col.get_bbox())) {
+    float disp_x = player->get_bbox().get_left() - m_col.get_bbox().get_left();
+    float disp_y = player->get_bbox().get_top() - m_col.get_bbox().get_top();
     if (disp_x * disp_x + disp_y * disp_y <= 256 * 256)
     {
       if (graphicsRandom.rand(0, 2) == 0) {
-        float px = graphicsRandom.randf(m_col.m_bbox.get_left(), m_col.m_bbox.get_right());
-        float py = graphicsRandom.randf(m_col.m_bbox.get_top(), m_col.m_bbox.get_bottom());
+        float px = graphicsRandom.randf(m_col.get_bbox().get_left(), m_col.get_bbox().get_right());
+        float py = graphicsRandom.randf(m_col.get_bbox().get_top(), m_col.get_bbox().get_bottom());
         Vector ppos = Vector(px, py);
         Vector pspeed = Vector(0, 0);
         Vector paccel = Vector(0, 0);
@@ -71,7 +71,13 @@ void
 Star::draw(DrawingContext& context)
 {
   MovingSprite::draw(context);
-  lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+  lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), 0);
+}
+
+float
+Star::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *lightsprite);
 }
 
 void
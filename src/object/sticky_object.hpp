@@ -46,7 +46,7 @@ private:
   {
     for (auto& obj : Sector::get().get_objects_by_type<T>())
     {
-      if (m_col.m_bbox.grown(8.f).overlaps(obj.get_bbox()))
+      if (m_col.get_bbox().grown(8.f).overlaps(obj.get_bbox()))
       {
         m_col.set_movement(obj.get_movement());
         if (!m_sticking)
@@ -96,7 +96,7 @@ private:
   {
     for (auto& obj : Sector::get().get_objects_by_type<T>())
     {
-      if (m_col.m_bbox.grown(8.f).overlaps(obj.get_bbox()))
+      if (m_col.get_bbox().grown(8.f).overlaps(obj.get_bbox()))
       {
         m_col.set_movement(obj.get_movement());
         if (!m_sticking)
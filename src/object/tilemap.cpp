@@ -49,6 +49,19 @@ TileMap::TileMap(const TileSet *new_tileset) :
   m_tiles(),
   m_real_solid(false),
   m_effective_solid(false),
+  m_collision_flags(),
+  m_collision_chunks(),
+  m_collision_columns(),
+  m_collision_chunks_width(0),
+  m_collision_chunks_height(0),
+  m_draw_chunks(),
+  m_draw_chunks_width(0),
+  m_draw_surfaces(),
+  m_draw_slots(),
+  m_draw_frame(),
+  m_draw_frame_slots(),
+  m_draw_chunk_batches(),
+  m_tileset_generation(m_tileset ? m_tileset->get_generation() : 0),
   m_speed_x(1),
   m_speed_y(1),
   m_width(0),
@@ -83,6 +96,19 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
   m_tiles(),
   m_real_solid(false),
   m_effective_solid(false),
+  m_collision_flags(),
+  m_collision_chunks(),
+  m_collision_columns(),
+  m_collision_chunks_width(0),
+  m_collision_chunks_height(0),
+  m_draw_chunks(),
+  m_draw_chunks_width(0),
+  m_draw_surfaces(),
+  m_draw_slots(),
+  m_draw_frame(),
+  m_draw_frame_slots(),
+  m_draw_chunk_batches(),
+  m_tileset_generation(m_tileset ? m_tileset->get_generation() : 0),
   m_speed_x(1),
   m_speed_y(1),
   m_width(-1),
@@ -199,6 +225,8 @@ TileMap::parse_tiles(const ReaderMapping& reader)
     m_tileset->get(tile);
   }
 
+  tiles_changed();
+
   if (empty)
   {
     log_info << "Tilemap '" << get_name() << "', z-pos '" << m_z_pos << "' is empty." << std::endl;
@@ -427,6 +455,9 @@ TileMap::check_state()
 void
 TileMap::update(float dt_sec)
 {
+  if (m_tileset && m_tileset->get_generation() != m_tileset_generation)
+    tiles_changed();
+
   // handle tilemap fading
   if (m_current_alpha != m_alpha) {
     m_remaining_fade_time = std::max(0.0f, m_remaining_fade_time - dt_sec);
@@ -549,6 +580,19 @@ TileMap::draw(DrawingContext& context)
 
   Rectf draw_rect = context.get_cliprect();
   Rect t_draw_rect = get_tiles_overlapping(draw_rect);
+
+  // Outside of the editor and the collision debug view, every tile is
+  // drawn with its surface only, so the prebuilt chunks can be used.
+  if (!Editor::is_active() && !g_debug.show_collision_rects)
+  {
+    if (m_tileset->get_generation() != m_tileset_generation)
+      tiles_changed();
+
+    draw_chunks(context.get_canvas(m_draw_target), t_draw_rect);
+    context.pop_transform();
+    return;
+  }
+
   Vector start = get_tile_position(t_draw_rect.left, t_draw_rect.top);
 
   Vector pos(0.0f, 0.0f);
@@ -596,8 +640,8 @@ TileMap::draw(DrawingContext& context)
     const SurfacePtr& surface = it.first;
     if (surface) {
       canvas.draw_surface_batch(surface,
-                                std::move(std::get<0>(it.second)),
-                                std::move(std::get<1>(it.second)),
+                                std::get<0>(it.second),
+                                std::get<1>(it.second),
                                 m_current_tint, m_z_pos);
     }
   }
@@ -628,6 +672,8 @@ TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
   // make sure all tiles are loaded
   for (const auto& tile : m_tiles)
     m_tileset->get(tile);
+
+  tiles_changed();
 }
 
 void
@@ -676,6 +722,8 @@ TileMap::resize(int new_width, int new_height, int fill_id,
     apply_offset_x(fill_id, xoffset);
   if (!offset_finished_y)
     apply_offset_y(fill_id, yoffset);
+
+  tiles_changed();
 }
 
 void
@@ -759,6 +807,27 @@ TileMap::get_tile(int x, int y) const
   return m_tileset->get(id);
 }
 
+uint8_t
+TileMap::get_collision_flags(uint32_t attributes)
+{
+  uint8_t flags = 0;
+  if (attributes & Tile::SOLID)
+    flags |= COLLISION_SOLID;
+  if (attributes & Tile::UNISOLID)
+    flags |= COLLISION_UNISOLID;
+  if (attributes & Tile::SLOPE)
+    flags |= COLLISION_SLOPE;
+  if (attributes & ~static_cast<uint32_t>(Tile::SOLID | Tile::UNISOLID | Tile::SLOPE))
+    flags |= COLLISION_ATTRIBUTES;
+  return flags;
+}
+
+uint8_t
+TileMap::get_collision_flags(int x, int y) const
+{
+  return get_collision_flags(get_tile(x, y).get_attributes());
+}
+
 uint32_t
 TileMap::get_tile_id_at(const Vector& pos) const
 {
@@ -786,12 +855,14 @@ TileMap::change(int x, int y, uint32_t newtile)
     return;
 
   m_tiles[y*m_width + x] = newtile;
+  tile_changed(x, y);
 }
 
 void
 TileMap::change(int idx, uint32_t newtile)
 {
   m_tiles[idx] = newtile;
+  tile_changed(idx % m_width, idx / m_width);
 }
 
 void
@@ -845,6 +916,7 @@ TileMap::autotile(const Vector& pos, uint32_t tile, AutotileSet* autotileset)
   {
     const int pos_x = static_cast<int>(pos.x), pos_y = static_cast<int>(pos.y);
     m_tiles[pos_y*m_width + pos_x] = tile;
+    tile_changed(pos_x, pos_y);
 
     for (int y = static_cast<int>(pos_y) - 1; y <= static_cast<int>(pos_y) + 1; y++)
     {
@@ -886,6 +958,7 @@ TileMap::autotile_single(int x, int y, AutotileSet* autotileset)
     autotileset->is_solid(get_tile_id(x  , y+1)),
     autotileset->is_solid(get_tile_id(x+1, y+1)),
     x, y);
+  tile_changed(x, y);
 }
 
 void
@@ -923,6 +996,7 @@ TileMap::autotile_single_corner(int x, int y, AutotileSet* autotileset, Autotile
     false,
     (mask & 0x01) != 0,
     x, y);
+  tile_changed(x, y);
 }
 
 void
@@ -961,6 +1035,7 @@ TileMap::autotile_erase(const Vector& pos, AutotileSet* autotileset)
       return;
 
     m_tiles[pos_y*m_width + pos_x] = 0;
+    tile_changed(pos_x, pos_y);
 
     for (int y = pos_y - 1; y <= pos_y + 1; y++)
     {
@@ -1046,10 +1121,255 @@ TileMap::update_effective_solid(bool update_manager)
   else if (!m_effective_solid && (m_current_alpha >= 0.75f))
     m_effective_solid = true;
 
+  // The collision map is kept while fading, only the real solidity
+  // decides whether it is needed.
+  if (m_real_solid == m_collision_flags.empty())
+    update_collision_map();
+
   if (update_manager)
     get_parent()->update_solid(this);
 }
 
+void
+TileMap::update_collision_map()
+{
+  m_collision_flags.clear();
+  m_collision_chunks.clear();
+  m_collision_columns.clear();
+  m_collision_chunks_width = 0;
+  m_collision_chunks_height = 0;
+
+  if (!m_real_solid || m_width <= 0 || m_height <= 0 ||
+      static_cast<int>(m_tiles.size()) != m_width * m_height)
+    return;
+
+  m_collision_chunks_width = (m_width + COLLISION_CHUNK_SIZE - 1) / COLLISION_CHUNK_SIZE;
+  m_collision_chunks_height = (m_height + COLLISION_CHUNK_SIZE - 1) / COLLISION_CHUNK_SIZE;
+  m_collision_flags.resize(m_tiles.size());
+  m_collision_chunks.assign(m_collision_chunks_width * m_collision_chunks_height, 0);
+  m_collision_columns.assign(m_width * m_collision_chunks_height, 0);
+
+  for (int y = 0; y < m_height; ++y)
+  {
+    for (int x = 0; x < m_width; ++x)
+    {
+      const uint8_t flags = get_collision_flags(m_tileset->get(m_tiles[y*m_width + x]).get_attributes());
+      m_collision_flags[y*m_width + x] = flags;
+      if (!flags)
+        continue;
+
+      const int chunk_y = y / COLLISION_CHUNK_SIZE;
+      m_collision_chunks[chunk_y * m_collision_chunks_width + x / COLLISION_CHUNK_SIZE] |= flags;
+      m_collision_columns[x * m_collision_chunks_height + chunk_y] |= static_cast<uint16_t>(1 << (y % COLLISION_CHUNK_SIZE));
+    }
+  }
+}
+
+void
+TileMap::update_collision_tile(int x, int y)
+{
+  if (m_collision_flags.empty())
+    return;
+
+  const uint8_t flags = get_collision_flags(m_tileset->get(m_tiles[y*m_width + x]).get_attributes());
+  const uint8_t old_flags = m_collision_flags[y*m_width + x];
+  if (flags == old_flags)
+    return;
+
+  m_collision_flags[y*m_width + x] = flags;
+
+  const int chunk_x = x / COLLISION_CHUNK_SIZE;
+  const int chunk_y = y / COLLISION_CHUNK_SIZE;
+
+  uint16_t& column = m_collision_columns[x * m_collision_chunks_height + chunk_y];
+  const uint16_t bit = static_cast<uint16_t>(1 << (y % COLLISION_CHUNK_SIZE));
+  column = static_cast<uint16_t>(flags ? (column | bit) : (column & ~bit));
+
+  uint8_t& chunk = m_collision_chunks[chunk_y * m_collision_chunks_width + chunk_x];
+  if (!(old_flags & ~flags))
+  {
+    chunk |= flags;
+    return;
+  }
+
+  // A flag was removed, the other tiles of the chunk may still have it.
+  chunk = 0;
+  const int right = std::min((chunk_x + 1) * COLLISION_CHUNK_SIZE, m_width);
+  const int bottom = std::min((chunk_y + 1) * COLLISION_CHUNK_SIZE, m_height);
+  for (int chunk_tile_y = chunk_y * COLLISION_CHUNK_SIZE; chunk_tile_y < bottom; ++chunk_tile_y)
+    for (int chunk_tile_x = chunk_x * COLLISION_CHUNK_SIZE; chunk_tile_x < right; ++chunk_tile_x)
+      chunk |= m_collision_flags[chunk_tile_y * m_width + chunk_tile_x];
+}
+
+void
+TileMap::tile_changed(int x, int y)
+{
+  update_collision_tile(x, y);
+
+  if (!m_draw_chunks.empty())
+    m_draw_chunks[(y / DRAW_CHUNK_SIZE) * m_draw_chunks_width + x / DRAW_CHUNK_SIZE].dirty = true;
+}
+
+void
+TileMap::tiles_changed()
+{
+  update_collision_map();
+
+  // The draw chunks are rebuilt lazily by draw_chunks().
+  m_draw_chunks.clear();
+  m_draw_chunks_width = 0;
+  m_draw_surfaces.clear();
+  m_draw_slots.clear();
+  m_draw_frame.clear();
+  m_draw_frame_slots.clear();
+
+  m_tileset_generation = m_tileset ? m_tileset->get_generation() : 0;
+}
+
+uint32_t
+TileMap::get_draw_slot(const SurfacePtr& surface)
+{
+  const auto key = std::make_tuple(surface->get_texture().get(),
+                                   surface->get_displacement_texture().get(),
+                                   surface->get_flip());
+  auto it = m_draw_slots.find(key);
+  if (it != m_draw_slots.end())
+    return it->second;
+
+  const uint32_t slot = static_cast<uint32_t>(m_draw_surfaces.size());
+  m_draw_slots.emplace(key, slot);
+  m_draw_surfaces.push_back(surface);
+  m_draw_frame.push_back({ slot, {}, {} });
+  return slot;
+}
+
+void
+TileMap::update_draw_chunk(int chunk_x, int chunk_y)
+{
+  DrawChunk& chunk = m_draw_chunks[chunk_y * m_draw_chunks_width + chunk_x];
+  chunk.batches.clear();
+  chunk.animated_tiles.clear();
+
+  const int right = std::min((chunk_x + 1) * DRAW_CHUNK_SIZE, m_width);
+  const int bottom = std::min((chunk_y + 1) * DRAW_CHUNK_SIZE, m_height);
+  for (int y = chunk_y * DRAW_CHUNK_SIZE; y < bottom; ++y)
+  {
+    for (int x = chunk_x * DRAW_CHUNK_SIZE; x < right; ++x)
+    {
+      const int index = y * m_width + x;
+      if (m_tiles[index] == 0)
+        continue;
+
+      const Tile& tile = m_tileset->get(m_tiles[index]);
+      if (tile.is_animated())
+      {
+        chunk.animated_tiles.push_back(index);
+        continue;
+      }
+
+      const SurfacePtr surface = tile.get_current_surface();
+      if (!surface)
+        continue;
+
+      const uint32_t slot = get_draw_slot(surface);
+      if (m_draw_chunk_batches.size() < m_draw_surfaces.size())
+        m_draw_chunk_batches.resize(m_draw_surfaces.size(), -1);
+
+      int& batch = m_draw_chunk_batches[slot];
+      if (batch < 0)
+      {
+        batch = static_cast<int>(chunk.batches.size());
+        chunk.batches.push_back({ slot, {}, {} });
+      }
+
+      chunk.batches[batch].srcrects.emplace_back(surface->get_region());
+      chunk.batches[batch].dstrects.emplace_back(Vector(static_cast<float>(x), static_cast<float>(y)) * 32.0f,
+                                                 Sizef(static_cast<float>(surface->get_width()),
+                                                       static_cast<float>(surface->get_height())));
+    }
+  }
+
+  for (const auto& batch : chunk.batches)
+    m_draw_chunk_batches[batch.slot] = -1;
+
+  chunk.dirty = false;
+}
+
+void
+TileMap::draw_chunks(Canvas& canvas, const Rect& tiles)
+{
+  if (tiles.left >= tiles.right || tiles.top >= tiles.bottom)
+    return;
+
+  if (m_draw_chunks.empty())
+  {
+    m_draw_chunks_width = (m_width + DRAW_CHUNK_SIZE - 1) / DRAW_CHUNK_SIZE;
+    m_draw_chunks.resize(m_draw_chunks_width * ((m_height + DRAW_CHUNK_SIZE - 1) / DRAW_CHUNK_SIZE));
+  }
+
+  const Vector offset = get_offset();
+  const Rectf visible(static_cast<float>(tiles.left) * 32.0f, static_cast<float>(tiles.top) * 32.0f,
+                      static_cast<float>(tiles.right) * 32.0f, static_cast<float>(tiles.bottom) * 32.0f);
+
+  auto add = [this](uint32_t slot, const Rectf& srcrect, const Rectf& dstrect)
+  {
+    DrawBatch& frame = m_draw_frame[slot];
+    if (frame.dstrects.empty())
+      m_draw_frame_slots.push_back(slot);
+    frame.srcrects.push_back(srcrect);
+    frame.dstrects.push_back(dstrect);
+  };
+
+  for (int chunk_y = tiles.top / DRAW_CHUNK_SIZE; chunk_y <= (tiles.bottom - 1) / DRAW_CHUNK_SIZE; ++chunk_y)
+  {
+    for (int chunk_x = tiles.left / DRAW_CHUNK_SIZE; chunk_x <= (tiles.right - 1) / DRAW_CHUNK_SIZE; ++chunk_x)
+    {
+      if (m_draw_chunks[chunk_y * m_draw_chunks_width + chunk_x].dirty)
+        update_draw_chunk(chunk_x, chunk_y);
+
+      const DrawChunk& chunk = m_draw_chunks[chunk_y * m_draw_chunks_width + chunk_x];
+      for (const auto& batch : chunk.batches)
+      {
+        for (size_t i = 0; i < batch.dstrects.size(); ++i)
+        {
+          const Vector& pos = batch.dstrects[i].p1();
+          if (pos.x < visible.get_left() || pos.x >= visible.get_right() ||
+              pos.y < visible.get_top() || pos.y >= visible.get_bottom())
+            continue;
+
+          add(batch.slot, batch.srcrects[i], batch.dstrects[i].moved(offset));
+        }
+      }
+
+      for (const int index : chunk.animated_tiles)
+      {
+        const int x = index % m_width;
+        const int y = index / m_width;
+        if (x < tiles.left || x >= tiles.right || y < tiles.top || y >= tiles.bottom)
+          continue;
+
+        const SurfacePtr surface = m_tileset->get(m_tiles[index]).get_current_surface();
+        if (!surface)
+          continue;
+
+        add(get_draw_slot(surface), surface->get_region(),
+            Rectf(get_tile_position(x, y), Sizef(static_cast<float>(surface->get_width()),
+                                                 static_cast<float>(surface->get_height()))));
+      }
+    }
+  }
+
+  for (const uint32_t slot : m_draw_frame_slots)
+  {
+    DrawBatch& frame = m_draw_frame[slot];
+    canvas.draw_surface_batch(m_draw_surfaces[slot], frame.srcrects, frame.dstrects,
+                              m_current_tint, m_z_pos);
+    frame.srcrects.clear();
+    frame.dstrects.clear();
+  }
+  m_draw_frame_slots.clear();
+}
+
 
 void
 TileMap::register_class(ssq::VM& vm)
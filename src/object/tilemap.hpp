@@ -19,6 +19,8 @@
 #include "editor/layer_object.hpp"
 
 #include <algorithm>
+#include <map>
+#include <tuple>
 #include <unordered_set>
 
 #include "math/rect.hpp"
@@ -30,8 +32,11 @@
 #include "video/color.hpp"
 #include "video/flip.hpp"
 #include "video/drawing_target.hpp"
+#include "video/surface_ptr.hpp"
 
 class AutotileSet;
+class Canvas;
+class Texture;
 class CollisionObject;
 class CollisionGroundMovementManager;
 class DrawingContext;
@@ -53,6 +58,23 @@ class TileMap final : public LayerObject,
 public:
   static void register_class(ssq::VM& vm);
 
+  /** Coarse classes of tile attributes, see for_each_collision_tile(). */
+  enum CollisionFlags : uint8_t
+  {
+    COLLISION_SOLID = 1 << 0,
+    COLLISION_UNISOLID = 1 << 1,
+    COLLISION_SLOPE = 1 << 2,
+    /** any other attribute */
+    COLLISION_ATTRIBUTES = 1 << 3,
+    COLLISION_ALL = COLLISION_SOLID | COLLISION_UNISOLID | COLLISION_SLOPE | COLLISION_ATTRIBUTES
+  };
+
+  /** Returns the collision flags covering the given tile attributes. */
+  static uint8_t get_collision_flags(uint32_t attributes);
+
+  /** Side length, in tiles, of the chunks summarized by the collision map. */
+  static const int COLLISION_CHUNK_SIZE = 16;
+
 public:
   TileMap(const TileSet *tileset);
   TileMap(const TileSet *tileset, const ReaderMapping& reader);
@@ -141,6 +163,54 @@ public:
       overlap the given rectangle in the sector. */
   Rect get_tiles_overlapping(const Rectf &rect) const;
 
+  /** Calls func(x, y) for the tiles in the given half-open rectangle
+      of tile indices that have any of the given collision flags, until
+      func returns true. Tiles are visited column by column, from top
+      to bottom. Solid tilemaps keep a map of the flags, so chunks and
+      runs of tiles without them are skipped without looking at the
+      tiles.
+
+      Returns true if func returned true. */
+  template<typename F>
+  bool for_each_collision_tile(const Rect& tiles, uint8_t flags, F func) const
+  {
+    const int left = std::max(tiles.left, 0);
+    const int top = std::max(tiles.top, 0);
+    const int right = std::min(tiles.right, m_width);
+    const int bottom = std::min(tiles.bottom, m_height);
+
+    if (m_collision_flags.empty())
+    {
+      for (int x = left; x < right; ++x)
+        for (int y = top; y < bottom; ++y)
+          if ((get_collision_flags(x, y) & flags) && func(x, y))
+            return true;
+
+      return false;
+    }
+
+    for (int x = left; x < right; ++x)
+    {
+      const int chunk_x = x / COLLISION_CHUNK_SIZE;
+      int y = top;
+      while (y < bottom)
+      {
+        const int chunk_y = y / COLLISION_CHUNK_SIZE;
+        const int chunk_bottom = std::min((chunk_y + 1) * COLLISION_CHUNK_SIZE, bottom);
+        if (m_collision_chunks[chunk_y * m_collision_chunks_width + chunk_x] & flags)
+        {
+          unsigned bits = m_collision_columns[x * m_collision_chunks_height + chunk_y] >> (y % COLLISION_CHUNK_SIZE);
+          for (; bits != 0 && y < chunk_bottom; ++y, bits >>= 1)
+            if ((bits & 1) && (m_collision_flags[y * m_width + x] & flags) && func(x, y))
+              return true;
+        }
+        y = chunk_bottom;
+      }
+    }
+
+    return false;
+  }
+
   /** Called by the collision mechanism to indicate that this tilemap has been hit on
       the top, i.e. has hit a moving object on the bottom of its collision rectangle. */
   void hits_object_bottom(CollisionObject& object);
@@ -166,6 +236,7 @@ public:
 
   bool is_outside_bounds(const Vector& pos) const;
   const Tile& get_tile(int x, int y) const;
+  uint8_t get_collision_flags(int x, int y) const;
   const Tile& get_tile_at(const Vector& pos) const;
   /**
    * @scripting
@@ -265,12 +336,32 @@ public:
 
   inline float get_target_alpha() const { return m_alpha; }
 
-  inline void set_tileset(const TileSet* tileset) { m_tileset = tileset; }
+  inline void set_tileset(const TileSet* tileset)
+  {
+    m_tileset = tileset;
+    tiles_changed();
+  }
 
   inline const std::vector<uint32_t>& get_tiles() const { return m_tiles; }
 
 private:
   void update_effective_solid(bool update_manager = true);
+
+  /** Updates the cached tile data after the tile at (x, y) changed. */
+  void tile_changed(int x, int y);
+  /** Drops or rebuilds all cached tile data, after bulk changes. */
+  void tiles_changed();
+
+  /** Rebuilds the collision map, or drops it if the tilemap isn't solid. */
+  void update_collision_map();
+  /** Updates the collision map after the tile at (x, y) changed. */
+  void update_collision_tile(int x, int y);
+
+  /** Submits the given half-open rectangle of tiles from the cached
+      draw chunks, see m_draw_chunks. */
+  void draw_chunks(Canvas& canvas, const Rect& tiles);
+  void update_draw_chunk(int chunk_x, int chunk_y);
+  uint32_t get_draw_slot(const SurfacePtr& surface);
   void float_channel(float target, float &current, float remaining_time, float dt_sec);
 
   /** Puts the correct single autotile block at the given position */
@@ -316,6 +407,57 @@ private:
   bool m_real_solid;
   bool m_effective_solid;
 
+  /** Map of the collision flags used by for_each_collision_tile(),
+      kept while the tilemap is solid. Holds the flags of every tile,
+      the union of the flags of every chunk and, for every column of a
+      chunk, one bit per tile telling whether it has any flags. */
+  std::vector<uint8_t> m_collision_flags;
+  std::vector<uint8_t> m_collision_chunks;
+  std::vector<uint16_t> m_collision_columns;
+  int m_collision_chunks_width;
+  int m_collision_chunks_height;
+
+  /** Side length, in tiles, of the chunks of m_draw_chunks. */
+  static const int DRAW_CHUNK_SIZE = 32;
+
+  /** Source and destination rectangles of the tiles drawn with one
+      texture, the slot indexes m_draw_surfaces. */
+  struct DrawBatch
+  {
+    uint32_t slot;
+    std::vector<Rectf> srcrects;
+    std::vector<Rectf> dstrects;
+  };
+
+  /** The batches of the non-animated tiles of a chunk, with
+      destinations relative to the offset of the tilemap, and the
+      indices of its animated tiles, whose surface depends on time. */
+  struct DrawChunk
+  {
+    std::vector<DrawBatch> batches;
+    std::vector<int> animated_tiles;
+    bool dirty = true;
+  };
+
+  /** Prebuilt draw batches outside of the editor, so that drawing a
+      static tilemap doesn't need to look at every visible tile. */
+  std::vector<DrawChunk> m_draw_chunks;
+  int m_draw_chunks_width;
+  std::vector<SurfacePtr> m_draw_surfaces;
+  /** Surfaces that share their textures and flip, like the tiles on
+      one texture atlas page, share a slot and are drawn together. */
+  std::map<std::tuple<const Texture*, const Texture*, Flip>, uint32_t> m_draw_slots;
+
+  /** Reused every frame: the batches to submit, indexed by slot, the
+      slots that are in use, and the batch of every slot while a chunk
+      is rebuilt. */
+  std::vector<DrawBatch> m_draw_frame;
+  std::vector<uint32_t> m_draw_frame_slots;
+  std::vector<int> m_draw_chunk_batches;
+
+  /** TileSet::get_generation() that the cached tile data is for. */
+  int m_tileset_generation;
+
   float m_speed_x;
   float m_speed_y;
   int m_width;
@@ -72,6 +72,15 @@ Torch::draw(DrawingContext& context)
   m_sprite->draw(context.color(), get_pos(), m_layer - 1, m_flip);
 }
 
+float
+Torch::get_draw_margin() const
+{
+  float margin = MovingSprite::get_draw_margin();
+  margin = add_sprite_margin(margin, *m_flame);
+  margin = add_sprite_margin(margin, *m_flame_glow);
+  return add_sprite_margin(margin, *m_flame_light);
+}
+
 void
 Torch::update(float)
 {
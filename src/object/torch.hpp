@@ -36,6 +36,7 @@ public:
   Torch(const ReaderMapping& reader);
 
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   virtual void update(float) override;
 
   virtual HitResponse collision(MovingObject& other, const CollisionHit& ) override;
@@ -36,7 +36,7 @@ TuxDoll::TuxDoll(const Vector& pos, Direction direction) :
 void
 TuxDoll::update(float dt_sec)
 {
-  if (!Sector::get().inside(m_col.m_bbox))
+  if (!Sector::get().inside(m_col.get_bbox()))
     remove_me();
 
   m_col.set_movement(physic.get_movement(dt_sec));
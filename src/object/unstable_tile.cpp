@@ -94,8 +94,8 @@ UnstableTile::collision(MovingObject& other, const CollisionHit& )
   {
     Player* player = dynamic_cast<Player*>(&other);
     if (player != nullptr &&
-       (player->get_bbox().get_bottom() < m_col.m_bbox.get_top() + SHIFT_DELTA ||
-       player->get_bbox().get_top() < m_col.m_bbox.get_bottom() + SHIFT_DELTA))
+       (player->get_bbox().get_bottom() < m_col.get_bbox().get_top() + SHIFT_DELTA ||
+       player->get_bbox().get_top() < m_col.get_bbox().get_bottom() + SHIFT_DELTA))
     {
       if (m_type == DELAYED)
         m_player_hit = true;
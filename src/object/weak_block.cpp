@@ -216,10 +216,16 @@ WeakBlock::draw(DrawingContext& context)
   MovingSprite::draw(context);
   if (m_type == HAY && (state != STATE_NORMAL))
   {
-    lightsprite->draw(context.light(), m_col.m_bbox.get_middle(), 0);
+    lightsprite->draw(context.light(), m_col.get_bbox().get_middle(), 0);
   }
 }
 
+float
+WeakBlock::get_draw_margin() const
+{
+  return add_sprite_margin(MovingSprite::get_draw_margin(), *lightsprite);
+}
+
 void
 WeakBlock::startBurning()
 {
@@ -241,8 +247,8 @@ WeakBlock::spreadHit()
     for (auto& wb : Sector::get().get_objects_by_type<WeakBlock>()) {
       if (&wb != this && wb.state == STATE_NORMAL)
       {
-        const float dx = fabsf(wb.get_pos().x - m_col.m_bbox.get_left());
-        const float dy = fabsf(wb.get_pos().y - m_col.m_bbox.get_top());
+        const float dx = fabsf(wb.get_pos().x - m_col.get_bbox().get_left());
+        const float dy = fabsf(wb.get_pos().y - m_col.get_bbox().get_top());
         if ((dx <= 32.5f) && (dy <= 32.5f)) {
           wb.startBurning();
         }
@@ -30,6 +30,7 @@ public:
   virtual HitResponse collision(MovingObject& other, const CollisionHit& hit) override;
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
   static std::string class_name() { return "weak_block"; }
   virtual std::string get_class_name() const override { return class_name(); }
   static std::string display_name() { return _("Weak Tile"); }
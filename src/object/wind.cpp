@@ -48,11 +48,13 @@ Wind::Wind(const ReaderMapping& reader) :
 {
   float w,h;
   parse_type(reader);
-  reader.get("x", m_col.m_bbox.get_left(), 0.0f);
-  reader.get("y", m_col.m_bbox.get_top(), 0.0f);
+  Vector pos(0.0f, 0.0f);
+  reader.get("x", pos.x, 0.0f);
+  reader.get("y", pos.y, 0.0f);
+  m_col.set_pos(pos);
   reader.get("width", w, 32.0f);
   reader.get("height", h, 32.0f);
-  m_col.m_bbox.set_size(w, h);
+  m_col.set_size(w, h);
 
   reader.get("z-pos", m_layer, LAYER_BACKGROUNDTILES + 1);
 
@@ -76,8 +78,8 @@ Wind::Wind(const ReaderMapping& reader) :
 ObjectSettings
 Wind::get_settings()
 {
-  new_size.x = m_col.m_bbox.get_width();
-  new_size.y = m_col.m_bbox.get_height();
+  new_size.x = m_col.get_bbox().get_width();
+  new_size.y = m_col.get_bbox().get_height();
 
   ObjectSettings result = MovingObject::get_settings();
 
@@ -116,13 +118,13 @@ Wind::update(float dt_sec_)
   dt_sec = dt_sec_;
 
   if (!blowing || !particles_enabled) return;
-  if (m_col.m_bbox.get_width() <= 16 || m_col.m_bbox.get_height() <= 16) return;
+  if (m_col.get_bbox().get_width() <= 16 || m_col.get_bbox().get_height() <= 16) return;
 
-  Vector ppos = Vector(graphicsRandom.randf(m_col.m_bbox.get_left() + 8, m_col.m_bbox.get_right() - 8), graphicsRandom.randf(m_col.m_bbox.get_top() + 8, m_col.m_bbox.get_bottom() - 8));
+  Vector ppos = Vector(graphicsRandom.randf(m_col.get_bbox().get_left() + 8, m_col.get_bbox().get_right() - 8), graphicsRandom.randf(m_col.get_bbox().get_top() + 8, m_col.get_bbox().get_bottom() - 8));
   Vector pspeed = Vector(graphicsRandom.randf(speed.x - 20, speed.x + 20), graphicsRandom.randf(speed.y - 20, speed.y + 20));
 
   // Approx. 1 particle per tile
-  if (graphicsRandom.randf(0.f, 100.f) < (m_col.m_bbox.get_width() / 32.f) * (m_col.m_bbox.get_height() / 32.f))
+  if (graphicsRandom.randf(0.f, 100.f) < (m_col.get_bbox().get_width() / 32.f) * (m_col.get_bbox().get_height() / 32.f))
   {
     // Emit a particle
     if (fancy_wind)
@@ -41,6 +41,7 @@
 #include "supertux/sector.hpp"
 #include "supertux/textscroller_screen.hpp"
 #include "supertux/title_screen.hpp"
+#include "video/render_stats.hpp"
 #include "worldmap/worldmap.hpp"
 
 namespace scripting {
@@ -326,6 +327,54 @@ static void debug_collrects(bool enable)
 {
   g_debug.show_collision_rects = enable;
 }
+/**
+ * @scripting
+ * @description Enables/disables drawing of the collision counters of the last frame.
+ * @param bool $enable
+ */
+static void debug_collision_stats(bool enable)
+{
+  g_debug.show_collision_stats = enable;
+}
+/**
+ * @scripting
+ * @description Enables/disables drawing of the draw call counters of the last frame.
+ * @param bool $enable
+ */
+static void debug_draw_stats(bool enable)
+{
+  g_debug.show_draw_stats = enable;
+}
+/**
+ * @scripting
+ * @description Prints the collision counters of the last frame in the current sector.
+ */
+static void debug_dump_collision_stats()
+{
+  if (!::Sector::current()) return;
+
+  ::Sector::get().get_collision_system().write_stats(get_logging_instance());
+}
+/**
+ * @scripting
+ * @description Prints the render counters of the last frame.
+ */
+static void debug_dump_render_stats()
+{
+  RenderStats::last().write(get_logging_instance());
+}
+/**
+ * @scripting
+ * @description Starts/stops writing the render counters of every frame to ""render_stats.csv"" in the user directory.
+ * @param bool $enable
+ */
+static void debug_record_render_stats(bool enable)
+{
+  if (enable)
+    RenderStats::start_recording("render_stats.csv");
+  else
+    RenderStats::stop_recording();
+}
 /**
  * @scripting
  * @description Enables/disables drawing of FPS.
@@ -843,6 +892,11 @@ void register_supertux_scripting_api(ssq::VM& vm)
   vm.addFunc("load_level", &scripting::Globals::load_level);
   vm.addFunc("import", &scripting::Globals::import);
   vm.addFunc("debug_collrects", &scripting::Globals::debug_collrects);
+  vm.addFunc("debug_collision_stats", &scripting::Globals::debug_collision_stats);
+  vm.addFunc("debug_dump_collision_stats", &scripting::Globals::debug_dump_collision_stats);
+  vm.addFunc("debug_draw_stats", &scripting::Globals::debug_draw_stats);
+  vm.addFunc("debug_dump_render_stats", &scripting::Globals::debug_dump_render_stats);
+  vm.addFunc("debug_record_render_stats", &scripting::Globals::debug_record_render_stats);
   vm.addFunc("debug_show_fps", &scripting::Globals::debug_show_fps);
   vm.addFunc("debug_draw_solids_only", &scripting::Globals::debug_draw_solids_only);
   vm.addFunc("debug_draw_editor_images", &scripting::Globals::debug_draw_editor_images);
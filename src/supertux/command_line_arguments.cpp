@@ -47,6 +47,7 @@ CommandLineArguments::CommandLineArguments() :
   sector(),
   spawnpoint(),
   developer_mode(),
+  parallel_collision(),
   christmas_mode(),
   repository_url(),
   editor(),
@@ -120,6 +121,8 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("  --show-pos                   Display player's current position") << "\n"
     << _("  --no-show-pos                Do not display player's position") << "\n"
     << _("  --developer                  Switch on developer feature") << "\n"
+    << _("  --parallel-collision         Look up collision candidates on worker threads") << "\n"
+    << _("  --no-parallel-collision      Do all collision work on the main thread") << "\n"
     << _("  -s, --debug-scripts          Enable script debugger.") << "\n"
     << _("  --spawn-pos X,Y              Where in the level to spawn Tux. Only used if level is specified.") << "\n"
     << _("  --sector SECTOR              Spawn Tux in SECTOR\n") << "\n"
@@ -305,6 +308,14 @@ CommandLineArguments::parse_args(int argc, char** argv)
     {
       developer_mode = true;
     }
+    else if (arg == "--parallel-collision")
+    {
+      parallel_collision = true;
+    }
+    else if (arg == "--no-parallel-collision")
+    {
+      parallel_collision = false;
+    }
     else if (arg == "--christmas")
     {
       christmas_mode = true;
@@ -409,6 +420,7 @@ CommandLineArguments::merge_into(Config& config)
   merge_option(enable_script_debugger)
   merge_option(tux_spawn_pos)
   merge_option(developer_mode)
+  merge_option(parallel_collision)
   merge_option(christmas_mode)
   merge_option(repository_url)
 
@@ -71,6 +71,7 @@ public:
   std::optional<std::string> spawnpoint;
 
   std::optional<bool> developer_mode;
+  std::optional<bool> parallel_collision;
 
   std::optional<bool> christmas_mode;
 
@@ -23,6 +23,10 @@ Debug g_debug;
 
 Debug::Debug() :
   show_collision_rects(false),
+  show_collision_stats(false),
+  show_draw_stats(false),
+  cull_offscreen_objects(true),
+  ttf_glyph_atlas(true),
   show_worldmap_path(false),
   draw_redundant_frames(false),
   show_toolbox_tile_ids(false),
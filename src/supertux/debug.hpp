@@ -31,6 +31,19 @@ public:
   /** Show collision rectangles of moving objects */
   bool show_collision_rects;
 
+  /** Show the counters of the collision system */
+  bool show_collision_stats;
+
+  /** Show the RenderStats of the last frame */
+  bool show_draw_stats;
+
+  /** Skip drawing moving objects that are outside of the screen */
+  bool cull_offscreen_objects;
+
+  /** Draw TTF text glyph by glyph from shared atlas pages instead of
+      rendering a texture for every string */
+  bool ttf_glyph_atlas;
+
   /** Draw the path on the worldmap, including invisible paths */
   bool show_worldmap_path;
 
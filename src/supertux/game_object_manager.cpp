@@ -19,6 +19,7 @@
 #include "supertux/game_object_manager.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 #include <simplesquirrel/class.hpp>
 #include <simplesquirrel/vm.hpp>
@@ -27,11 +28,33 @@
 #include "object/ambient_light.hpp"
 #include "object/music_object.hpp"
 #include "object/tilemap.hpp"
+#include "supertux/debug.hpp"
 #include "supertux/game_object_factory.hpp"
 #include "supertux/moving_object.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
 #include "util/writer.hpp"
+#include "video/drawing_context.hpp"
+#include "video/render_stats.hpp"
+
+namespace {
+
+/** Checks whether the drawing of object, as far as it may reach
+    outside of its bbox, could end up inside of cliprect. */
+bool is_visible(const MovingObject& object, const Rectf& cliprect)
+{
+  const float margin = object.get_draw_margin();
+  if (!std::isfinite(margin))
+    return true;
+
+  const Rectf& bbox = object.get_bbox();
+  return bbox.get_left() - margin < cliprect.get_right() &&
+         bbox.get_right() + margin > cliprect.get_left() &&
+         bbox.get_top() - margin < cliprect.get_bottom() &&
+         bbox.get_bottom() + margin > cliprect.get_top();
+}
+
+} // namespace
 
 bool GameObjectManager::s_draw_solids_only = false;
 
@@ -271,13 +294,31 @@ GameObjectManager::draw(DrawingContext& context)
     return;
   }
 
+  // Moving objects entirely outside of the screen would only produce
+  // requests that are clipped away again.
+  const bool cull = g_debug.cull_offscreen_objects;
+  const Rectf cliprect = context.get_cliprect();
+  int culled_objects = 0;
+
   for (const auto& object : m_gameobjects)
   {
     if (!object->is_valid())
       continue;
 
+    if (cull)
+    {
+      const auto* moving_object = dynamic_cast<const MovingObject*>(object.get());
+      if (moving_object && !is_visible(*moving_object, cliprect))
+      {
+        culled_objects += 1;
+        continue;
+      }
+    }
+
     object->draw(context);
   }
+
+  RenderStats::current().culled_objects += culled_objects;
 }
 
 void
@@ -72,10 +72,12 @@ Config::Config() :
   screen_shake_mode(ScreenShakeMode::FULL),
   max_viewport(false),
   fancy_gfx(true),
+  surface_cache_size(128),
   precise_scrolling(true),
   invert_wheel_x(false),
   invert_wheel_y(false),
   random_seed(0), // Set by time(), by default (unless in config).
+  parallel_collision(false),
   enable_script_debugger(false),
   tux_spawn_pos(),
   locale(),
@@ -293,6 +295,7 @@ Config::load()
   config_mapping.get("transitions_enabled", transitions_enabled);
   config_mapping.get("locale", locale);
   config_mapping.get("random_seed", random_seed);
+  config_mapping.get("parallel_collision", parallel_collision);
   config_mapping.get("repository_url", repository_url);
 
   config_mapping.get("multiplayer_auto_manage_players", multiplayer_auto_manage_players);
@@ -347,6 +350,7 @@ Config::load()
 
     config_video_mapping->get("magnification", magnification);
     config_video_mapping->get("fancy_gfx", fancy_gfx);
+    config_video_mapping->get("surface_cache_size", surface_cache_size);
     config_video_mapping->get("max_viewport", max_viewport);
 
     Viewport::force_full_viewport(max_viewport, true);
@@ -476,6 +480,7 @@ Config::save()
   writer.write("transitions_enabled", transitions_enabled);
   writer.write("locale", locale);
   writer.write("repository_url", repository_url);
+  writer.write("parallel_collision", parallel_collision);
   writer.write("multiplayer_auto_manage_players", multiplayer_auto_manage_players);
   writer.write("multiplayer_multibind", multiplayer_multibind);
   writer.write("multiplayer_buzz_controllers", multiplayer_buzz_controllers);
@@ -546,6 +551,7 @@ Config::save()
 
   writer.write("magnification", magnification);
   writer.write("fancy_gfx", fancy_gfx);
+  writer.write("surface_cache_size", surface_cache_size);
   writer.write("max_viewport", max_viewport);
 
   writer.end_list("video");
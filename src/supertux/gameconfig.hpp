@@ -101,9 +101,18 @@ public:
   /** Toggles fancy graphical effects like displacement or blur (primarily for the GL backend) */
   bool fancy_gfx;
 
+  /** Memory in MB for decoded images that textures are cut from, the
+      least recently used images are dropped and decoded again when
+      needed. */
+  int surface_cache_size;
+
   /** initial random seed.  0 ==> set from time() */
   int random_seed;
 
+  /** Looks up collision candidates on worker threads. The collision
+      callbacks still run in the same order, so gameplay is unchanged. */
+  bool parallel_collision;
+
   bool enable_script_debugger;
 
   /** this variable is set if tux should spawn somewhere which isn't the "main" spawn point*/
@@ -26,8 +26,10 @@
 #include "supertux/gameconfig.hpp"
 #include "supertux/globals.hpp"
 #include "supertux/resources.hpp"
+#include "supertux/sector.hpp"
 #include "util/gettext.hpp"
 #include "util/log.hpp"
+#include "video/render_stats.hpp"
 #include "video/texture_manager.hpp"
 
 DebugMenu::DebugMenu() :
@@ -65,6 +67,10 @@ DebugMenu::DebugMenu() :
   }
 
   add_toggle(-1, _("Show Collision Rects"), &g_debug.show_collision_rects);
+  add_toggle(-1, _("Show Collision Stats"), &g_debug.show_collision_stats);
+  add_toggle(-1, _("Show Draw Stats"), &g_debug.show_draw_stats);
+  add_toggle(-1, _("Cull Offscreen Objects"), &g_debug.cull_offscreen_objects);
+  add_toggle(-1, _("Glyph Atlas Text"), &g_debug.ttf_glyph_atlas);
   add_toggle(-1, _("Show Worldmap Path"), &g_debug.show_worldmap_path);
   add_toggle(-1, _("Show Controller"), &g_config->show_controller);
   add_toggle(-1, _("Show Framerate"), &g_config->show_fps);
@@ -81,6 +87,23 @@ DebugMenu::DebugMenu() :
 
   add_entry(_("Dump Texture Cache"), []{ TextureManager::current()->debug_print(get_logging_instance()); });
 
+  add_entry(_("Dump Collision Stats"), []{
+      if (Sector::current())
+        Sector::get().get_collision_system().write_stats(get_logging_instance());
+    });
+
+  add_entry(_("Dump Render Stats"), []{ RenderStats::last().write(get_logging_instance()); });
+
+  add_toggle(-1, _("Record Render Stats"),
+             []{ return RenderStats::is_recording(); },
+             [](bool value){
+               if (value)
+                 RenderStats::start_recording("render_stats.csv");
+               else
+                 RenderStats::stop_recording();
+             })
+    .set_help(_("Writes the render stats of every frame to render_stats.csv in the user directory."));
+
   add_hl();
   add_back(_("Back"));
 }
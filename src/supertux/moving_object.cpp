@@ -16,14 +16,17 @@
 
 #include "supertux/moving_object.hpp"
 
+#include <algorithm>
 #include <simplesquirrel/class.hpp>
 #include <simplesquirrel/vm.hpp>
 
 #include "editor/resize_marker.hpp"
 #include "object/portable.hpp"
+#include "sprite/sprite.hpp"
 #include "supertux/sector.hpp"
 #include "util/reader_mapping.hpp"
 #include "util/writer.hpp"
+#include "video/surface.hpp"
 
 MovingObject::MovingObject() :
   m_col(COLGROUP_MOVING, *this),
@@ -39,19 +42,33 @@ MovingObject::MovingObject(const ReaderMapping& reader) :
   float height, width;
 
   if (reader.get("width", width))
-    m_col.m_bbox.set_width(width);
+    m_col.set_width(width);
 
   if (reader.get("height", height))
-    m_col.m_bbox.set_height(height);
+    m_col.set_height(height);
 
-  reader.get("x", m_col.m_bbox.get_left());
-  reader.get("y", m_col.m_bbox.get_top());
+  Vector pos = get_pos();
+  reader.get("x", pos.x);
+  reader.get("y", pos.y);
+  m_col.set_pos(pos);
 }
 
 MovingObject::~MovingObject()
 {
 }
 
+float
+MovingObject::add_sprite_margin(float margin, const Sprite& sprite)
+{
+  return std::max(margin, static_cast<float>(std::max(sprite.get_width(), sprite.get_height())));
+}
+
+float
+MovingObject::add_sprite_margin(float margin, const Surface& surface)
+{
+  return std::max(margin, static_cast<float>(std::max(surface.get_width(), surface.get_height())));
+}
+
 ObjectSettings
 MovingObject::get_settings()
 {
@@ -86,6 +103,15 @@ MovingObject::set_parent_dispenser(Dispenser* dispenser)
   }
 }
 
+void
+MovingObject::after_editor_set()
+{
+  GameObject::after_editor_set();
+
+  // The settings above change the bounding box in place.
+  m_col.bbox_changed();
+}
+
 void
 MovingObject::editor_select()
 {
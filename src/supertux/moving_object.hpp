@@ -24,6 +24,8 @@
 
 class Dispenser;
 class Sector;
+class Sprite;
+class Surface;
 
 /**
  * @scripting
@@ -40,6 +42,10 @@ class MovingObject : public GameObject
 public:
   static void register_class(ssq::VM& vm);
 
+  /** Default of get_draw_margin(), for graphics that reach a bit
+      outside of the hitbox. */
+  static constexpr float DRAW_MARGIN = 32.0f;
+
 public:
   MovingObject();
   MovingObject(const ReaderMapping& reader);
@@ -72,17 +78,17 @@ public:
   }
   virtual void move(const Vector& dist)
   {
-    m_col.m_bbox.move(dist);
+    m_col.move(dist);
   }
 
   Vector get_pos() const
   {
-    return m_col.m_bbox.p1();
+    return m_col.get_bbox().p1();
   }
 
   const Rectf& get_bbox() const
   {
-    return m_col.m_bbox;
+    return m_col.get_bbox();
   }
 
   const Vector& get_movement() const
@@ -92,7 +98,7 @@ public:
 
   CollisionGroup get_group() const
   {
-    return m_col.m_group;
+    return m_col.get_group();
   }
 
   CollisionObject* get_collision_object() {
@@ -110,6 +116,7 @@ public:
   virtual std::string get_class_name() const override { return class_name(); }
   virtual std::string get_exposed_class_name() const override { return "MovingObject"; }
   virtual ObjectSettings get_settings() override;
+  virtual void after_editor_set() override;
 
   virtual void editor_select() override;
 
@@ -117,16 +124,22 @@ public:
 
   virtual int get_layer() const = 0;
 
+  /** Returns how far the drawing of the object may reach outside of
+      its bbox. Objects that are farther than this outside of the
+      visible area are not drawn at all, objects that draw in screen
+      coordinates return infinity. */
+  virtual float get_draw_margin() const { return DRAW_MARGIN; }
+
   /**
    * @scripting
    * @description Returns the object's X coordinate.
    */
-  inline float get_x() const { return m_col.m_bbox.get_left(); }
+  inline float get_x() const { return m_col.get_bbox().get_left(); }
   /**
    * @scripting
    * @description Returns the object's Y coordinate.
    */
-  inline float get_y() const { return m_col.m_bbox.get_top(); }
+  inline float get_y() const { return m_col.get_bbox().get_top(); }
   /**
    * @scripting
    * @description Sets the position of the object.
@@ -146,17 +159,22 @@ public:
    * @scripting
    * @description Returns the object's hitbox width.
    */
-  inline float get_width() const { return m_col.m_bbox.get_width(); }
+  inline float get_width() const { return m_col.get_bbox().get_width(); }
   /**
    * @scripting
    * @description Returns the object's hitbox height.
    */
-  inline float get_height() const { return m_col.m_bbox.get_height(); }
+  inline float get_height() const { return m_col.get_bbox().get_height(); }
 
 protected:
+  /** Returns margin, grown so that it also covers sprite when the
+      sprite is drawn anywhere inside of the bbox. */
+  static float add_sprite_margin(float margin, const Sprite& sprite);
+  static float add_sprite_margin(float margin, const Surface& surface);
+
   void set_group(CollisionGroup group)
   {
-    m_col.m_group = group;
+    m_col.set_group(group);
   }
 
 protected:
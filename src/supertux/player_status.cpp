@@ -417,7 +417,7 @@ PlayerStatus::PocketPowerUp::PocketPowerUp(BonusType bonustype, Vector pos):
   physic.set_velocity_y(-325.f);
   physic.set_gravity_modifier(0.4f);
   set_layer(LAYER_FOREGROUND1);
-  m_col.m_group = COLGROUP_DISABLED;
+  m_col.set_group(COLGROUP_DISABLED);
 }
 
 void
@@ -426,7 +426,7 @@ PlayerStatus::PocketPowerUp::update(float dt_sec)
   PowerUp::update(dt_sec);
 
   bool check = m_cooldown_timer.check();
-  if (!m_cooldown_timer.started() && !check && m_col.m_group != COLGROUP_TOUCHABLE)
+  if (!m_cooldown_timer.started() && !check && m_col.get_group() != COLGROUP_TOUCHABLE)
   {
     float sector_gravity = Sector::get().get_gravity();
     if (sector_gravity == 0.0f) {
@@ -441,7 +441,7 @@ PlayerStatus::PocketPowerUp::update(float dt_sec)
   {
     m_visible = true;
     m_blink_timer.stop();
-    m_col.m_group = COLGROUP_TOUCHABLE;
+    m_col.set_group(COLGROUP_TOUCHABLE);
   }
 
   if (m_blink_timer.check())
@@ -41,11 +41,14 @@
 #include "supertux/screen_fade.hpp"
 #include "supertux/sector.hpp"
 #include "util/log.hpp"
+#include "video/canvas.hpp"
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
+#include "video/render_stats.hpp"
 
 #include <stdio.h>
 #include <chrono>
+#include <fmt/format.h>
 #include <iostream>
 
 #ifdef __EMSCRIPTEN__
@@ -142,6 +145,7 @@ ScreenManager::ScreenManager(VideoSystem& video_system, InputManager& input_mana
   elapsed_time(0.0f),
   seconds_per_step(1.0f / LOGICAL_FPS),
   m_fps_statistics(new FPS_Stats()),
+  m_compositor(new Compositor(video_system)),
   m_speed(1.0),
   m_actions(),
   m_screen_fade(),
@@ -272,6 +276,37 @@ ScreenManager::draw_player_pos(DrawingContext& context)
   }
 }
 
+void
+ScreenManager::draw_stats(DrawingContext& context)
+{
+  const RenderStats& stats = RenderStats::last();
+  const std::string lines[] = {
+    "requests: " + std::to_string(stats.requests),
+    "merged: " + std::to_string(stats.merged_requests),
+    "state changes: " + std::to_string(stats.state_changes),
+    "draw calls: " + std::to_string(stats.draw_calls),
+    "texture binds: " + std::to_string(stats.texture_binds),
+    "program binds: " + std::to_string(stats.program_binds),
+    "vertices: " + std::to_string(stats.vertices),
+    "lightmap passes: " + std::to_string(stats.lightmap_passes),
+    "culled objects: " + std::to_string(stats.culled_objects),
+    "static light updates: " + std::to_string(stats.static_light_updates),
+    fmt::format("text layout hits: {:.0f}%", stats.get_text_layout_hit_rate() * 100.0f),
+    fmt::format("overdraw: {:.2f}", stats.get_overdraw()),
+    fmt::format("render: {:.2f} ms", stats.render_time)
+  };
+
+  Vector pos(context.get_width() - BORDER_X, BORDER_Y + 90);
+  for (const auto& line : lines)
+  {
+    context.color().draw_text(Resources::small_font, line, pos, ALIGN_RIGHT, LAYER_HUD);
+    pos.y += Resources::small_font->get_height();
+  }
+
+  if (RenderStats::is_recording())
+    context.color().draw_text(Resources::small_font, "recording", pos, ALIGN_RIGHT, LAYER_HUD, Color::RED);
+}
+
 void
 ScreenManager::draw(Compositor& compositor, FPS_Stats& fps_statistics)
 {
@@ -304,6 +339,10 @@ ScreenManager::draw(Compositor& compositor, FPS_Stats& fps_statistics)
     draw_player_pos(context);
   }
 
+  if (g_debug.show_draw_stats) {
+    draw_stats(context);
+  }
+
   MouseCursor::current()->draw(context);
 
   // render everything
@@ -691,8 +730,8 @@ void ScreenManager::loop_iter()
   if (((steps > 0 && !m_screen_stack.empty())
       || always_draw) && m_actions.empty() || m_screen_fade) {
     // Draw a frame
-    Compositor compositor(m_video_system, g_config->frame_prediction ? time_offset : 0.0f);
-    draw(compositor, *m_fps_statistics);
+    m_compositor->set_time_offset(g_config->frame_prediction ? time_offset : 0.0f);
+    draw(*m_compositor, *m_fps_statistics);
     m_fps_statistics->report_frame();
   }
 
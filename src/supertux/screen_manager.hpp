@@ -69,6 +69,7 @@ private:
   struct FPS_Stats;
   void draw_fps(DrawingContext& context, FPS_Stats& fps_statistics);
   void draw_player_pos(DrawingContext& context);
+  void draw_stats(DrawingContext& context);
   void draw(Compositor& compositor, FPS_Stats& fps_statistics);
   void update_gamelogic(float dt_sec);
   void process_events();
@@ -87,6 +88,10 @@ private:
   const float seconds_per_step;
   std::unique_ptr<FPS_Stats> m_fps_statistics;
 
+  /** Kept over frames, so that the memory of the drawing requests is
+      reused */
+  std::unique_ptr<Compositor> m_compositor;
+
   float m_speed;
   struct Action
   {
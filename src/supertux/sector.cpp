@@ -494,6 +494,10 @@ Sector::draw(DrawingContext& context)
   context.pop_transform();
 #endif
 
+  if (g_debug.show_collision_stats) {
+    m_collision_system->draw_stats(context);
+  }
+
   if (m_level.m_is_in_cutscene && !m_level.m_skip_cutscene)
   {
     context.color().draw_text(Resources::normal_font,
@@ -731,6 +735,21 @@ Sector::get_nearby_objects(const Vector& center, float max_distance) const
   return result;
 }
 
+std::vector<MovingObject*>
+Sector::get_overlapping_objects(const Rectf& rect) const
+{
+  std::vector<CollisionObject*> objects;
+  m_collision_system->get_overlapping_objects(rect, 0xFF, objects);
+
+  std::vector<MovingObject*> result;
+  result.reserve(objects.size());
+  for (auto* object : objects)
+  {
+    result.push_back(&object->get_parent());
+  }
+  return result;
+}
+
 void
 Sector::stop_looping_sounds()
 {
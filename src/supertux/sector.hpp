@@ -190,6 +190,8 @@ public:
                                                              const CollisionObject* ignore_object) const;
 
   bool free_line_of_sight(const Vector& line_start, const Vector& line_end, bool ignore_objects = false, const MovingObject* ignore_object = nullptr) const;
+
+  inline const CollisionSystem& get_collision_system() const { return *m_collision_system; }
   bool can_see_player(const Vector& eye) const;
 
   Player* get_nearest_player(const Vector& pos) const;
@@ -200,6 +202,10 @@ public:
 
   std::vector<MovingObject*> get_nearby_objects (const Vector& center, float max_distance) const;
 
+  /** Returns the objects of any collision group whose bounding box
+      overlaps rect, in unspecified order. */
+  std::vector<MovingObject*> get_overlapping_objects(const Rectf& rect) const;
+
   Rectf get_active_region() const;
 
   inline int get_foremost_opaque_layer() const { return m_foremost_opaque_layer; }
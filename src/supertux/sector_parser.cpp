@@ -42,6 +42,7 @@
 #include "supertux/tile.hpp"
 #include "util/reader_collection.hpp"
 #include "util/reader_mapping.hpp"
+#include "video/texture_manager.hpp"
 #include "worldmap/spawn_point.hpp"
 
 namespace
@@ -116,6 +117,10 @@ SectorParser::parse_object_additional(const std::string& name, const ReaderMappi
 void
 SectorParser::parse(const ReaderMapping& reader)
 {
+  // Decode the images named by the objects in parallel, so that
+  // creating the objects below only has to upload them.
+  TextureManager::current()->preload(TextureManager::find_images(reader.get_sexp()));
+
   auto iter = reader.get_iter();
   while (iter.next()) {
     if (iter.get_key() == "name")
@@ -141,6 +141,9 @@ public:
 
   inline bool is_deprecated() const { return m_deprecated; }
 
+  /** Returns true if the tile has more than one image to animate. */
+  inline bool is_animated() const { return m_images.size() > 1; }
+
   inline const std::string& get_object_name() const { return m_object_name; }
   inline const std::string& get_object_data() const { return m_object_data; }
 
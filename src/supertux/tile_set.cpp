@@ -51,7 +51,8 @@ TileSet::TileSet(const std::string& filename) :
   m_autotilesets(),
   m_thunderstorm_tiles(),
   m_tiles(1),
-  m_tilegroups()
+  m_tilegroups(),
+  m_generation(0)
 {
   m_tiles[0] = std::make_unique<Tile>();
 }
@@ -66,6 +67,8 @@ TileSet::reload()
 
   TileSetParser parser(*this, m_filename);
   parser.parse();
+
+  m_generation += 1;
 }
 
 void
@@ -51,6 +51,10 @@ public:
 
   void reload();
 
+  /** Increases with every reload(), so that users of the tiles can
+      tell that cached tile data is out of date. */
+  inline int get_generation() const { return m_generation; }
+
   void add_tile(int id, std::unique_ptr<Tile> tile);
 
   /** Adds a group of tiles that haven't
@@ -92,6 +96,7 @@ public:
 private:
   std::vector<std::unique_ptr<Tile> > m_tiles;
   std::vector<Tilegroup> m_tilegroups;
+  int m_generation;
 
 private:
   TileSet(const TileSet&) = delete;
@@ -30,6 +30,7 @@
 #include "util/reader_mapping.hpp"
 #include "util/file_system.hpp"
 #include "video/surface.hpp"
+#include "video/texture_manager.hpp"
 
 TileSetParser::TileSetParser(TileSet& tileset, const std::string& filename,
                              int32_t start, int32_t end, int32_t offset) :
@@ -70,6 +71,8 @@ TileSetParser::parse(bool imported)
     throw std::runtime_error("file is not a supertux tiles file.");
   }
 
+  TextureManager::current()->preload(TextureManager::find_images(root.get_sexp(), m_tiles_path));
+
   auto iter = root.get_mapping().get_iter();
   while (iter.next())
   {
@@ -16,6 +16,8 @@
 
 #include "trigger/climbable.hpp"
 
+#include <limits>
+
 #include "editor/editor.hpp"
 #include "object/player.hpp"
 #include "supertux/debug.hpp"
@@ -84,7 +86,7 @@ Climbable::update(float dt_sec)
   {
     if (it2->m_activate_try_timer->started())
     {
-      auto bbox_with_grace = m_col.m_bbox.grown(Vector(GRACE_DX, GRACE_DY));
+      auto bbox_with_grace = m_col.get_bbox().grown(Vector(GRACE_DX, GRACE_DY));
       // The "-20" to y velocity prevents Tux from walking in place on the ground for horizonal adjustments.
       if (it2->m_player->get_bbox().get_left() < bbox_with_grace.get_left())
         it2->m_player->add_velocity(Vector(POSITION_FIX_AX, -20));
@@ -120,6 +122,13 @@ Climbable::draw(DrawingContext& context)
   DraggableRegion::draw(context);
 }
 
+float
+Climbable::get_draw_margin() const
+{
+  // The message is drawn in screen coordinates.
+  return std::numeric_limits<float>::infinity();
+}
+
 void
 Climbable::event(Player& player, EventType type)
 {
@@ -164,9 +173,9 @@ bool
 Climbable::may_climb(const Player& player) const
 {
   if (player.is_swimming()) return false;
-  if (player.get_bbox().get_left() < m_col.m_bbox.get_left() - GRACE_DX) return false;
-  if (player.get_bbox().get_right() > m_col.m_bbox.get_right() + GRACE_DX) return false;
-  if (player.get_bbox().get_top() < m_col.m_bbox.get_top() - GRACE_DY) return false;
-  if (player.get_bbox().get_bottom() > m_col.m_bbox.get_bottom() + GRACE_DY) return false;
+  if (player.get_bbox().get_left() < m_col.get_bbox().get_left() - GRACE_DX) return false;
+  if (player.get_bbox().get_right() > m_col.get_bbox().get_right() + GRACE_DX) return false;
+  if (player.get_bbox().get_top() < m_col.get_bbox().get_top() - GRACE_DY) return false;
+  if (player.get_bbox().get_bottom() > m_col.get_bbox().get_bottom() + GRACE_DY) return false;
   return true;
 }
@@ -51,6 +51,7 @@ public:
   virtual void event(Player& player, EventType type) override;
   virtual void update(float dt_sec) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   /** returns true if the player is within bounds of the Climbable */
   bool may_climb(const Player& player) const;
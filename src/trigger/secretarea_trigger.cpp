@@ -16,6 +16,8 @@
 
 #include "trigger/secretarea_trigger.hpp"
 
+#include <limits>
+
 #include "audio/sound_manager.hpp"
 #include "editor/editor.hpp"
 #include "object/tilemap.hpp"
@@ -78,6 +80,13 @@ SecretAreaTrigger::draw(DrawingContext& context)
   DraggableRegion::draw(context);
 }
 
+float
+SecretAreaTrigger::get_draw_margin() const
+{
+  // The message is drawn in screen coordinates.
+  return std::numeric_limits<float>::infinity();
+}
+
 void
 SecretAreaTrigger::event(Player& , EventType type)
 {
@@ -41,6 +41,7 @@ public:
   virtual void event(Player& player, EventType type) override;
   virtual void update(float) override;
   virtual void draw(DrawingContext& context) override;
+  virtual float get_draw_margin() const override;
 
   inline const std::string& get_fade_tilemap_name() const { return fade_tilemap; }
 
@@ -0,0 +1,172 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * A map that holds at most a given total cost of values and drops the
+ * least recently used ones when that is exceeded. The cost of a value
+ * defaults to 1, so that the capacity is an amount of entries, but it
+ * can be e.g. the size of the value in bytes.
+ *
+ * Lookups are counted, so that the hit rate of a cache can be shown.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUCache final
+{
+public:
+  explicit LRUCache(size_t capacity) :
+    m_entries(),
+    m_index(),
+    m_capacity(capacity),
+    m_cost(0),
+    m_hits(0),
+    m_misses(0),
+    m_evictions(0)
+  {}
+
+  /** Returns the value stored for key and marks it as recently used,
+      or nullptr if there is none. The pointer stays valid until the
+      value is dropped from the cache. */
+  Value* get(const Key& key)
+  {
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+      m_misses += 1;
+      return nullptr;
+    }
+
+    m_hits += 1;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return &it->second->value;
+  }
+
+  /** Returns true if a value is stored for key, without counting
+      the lookup or marking the value as recently used. */
+  bool contains(const Key& key) const
+  {
+    return m_index.find(key) != m_index.end();
+  }
+
+  /** Stores value for key, replacing the previous one, and drops the
+      least recently used values until the capacity is kept. The new
+      value itself is always kept, even if it alone exceeds it. */
+  Value& put(const Key& key, Value value, size_t cost = 1)
+  {
+    erase(key);
+
+    m_entries.push_front({ key, std::move(value), cost });
+    m_index.emplace(key, m_entries.begin());
+    m_cost += cost;
+
+    shrink(m_capacity);
+    return m_entries.front().value;
+  }
+
+  bool erase(const Key& key)
+  {
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+      return false;
+
+    m_cost -= it->second->cost;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+    return true;
+  }
+
+  void clear()
+  {
+    m_entries.clear();
+    m_index.clear();
+    m_cost = 0;
+  }
+
+  /** Drops the least recently used values until at most cost is
+      used, keeping the most recently used value. */
+  void shrink(size_t cost)
+  {
+    while (m_cost > cost && m_entries.size() > 1)
+    {
+      const Entry& entry = m_entries.back();
+      m_cost -= entry.cost;
+      m_index.erase(entry.key);
+      m_entries.pop_back();
+      m_evictions += 1;
+    }
+  }
+
+  void set_capacity(size_t capacity)
+  {
+    m_capacity = capacity;
+    shrink(m_capacity);
+  }
+
+  inline size_t get_capacity() const { return m_capacity; }
+  inline size_t get_cost() const { return m_cost; }
+  inline size_t size() const { return m_entries.size(); }
+
+  inline uint64_t get_hits() const { return m_hits; }
+  inline uint64_t get_misses() const { return m_misses; }
+
+  /** Returns the amount of values dropped to keep the capacity */
+  inline uint64_t get_evictions() const { return m_evictions; }
+
+  /** Returns the fraction of get() calls that found a value */
+  float get_hit_rate() const
+  {
+    const uint64_t lookups = m_hits + m_misses;
+    return lookups == 0 ? 0.0f : static_cast<float>(m_hits) / static_cast<float>(lookups);
+  }
+
+  /** Calls func(key, value) for all values, most recently used first,
+      without marking them as used. */
+  template<typename F>
+  void for_each(F func) const
+  {
+    for (const auto& entry : m_entries)
+      func(entry.key, entry.value);
+  }
+
+private:
+  struct Entry
+  {
+    Key key;
+    Value value;
+    size_t cost;
+  };
+
+private:
+  std::list<Entry> m_entries;
+  std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> m_index;
+  size_t m_capacity;
+  size_t m_cost;
+  uint64_t m_hits;
+  uint64_t m_misses;
+  uint64_t m_evictions;
+
+private:
+  LRUCache(const LRUCache&) = delete;
+  LRUCache& operator=(const LRUCache&) = delete;
+};
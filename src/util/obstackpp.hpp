@@ -17,6 +17,8 @@
 #pragma once
 
 #include <obstack.h>
+#include <memory>
+#include <type_traits>
 
 inline void*
 operator new (size_t bytes, struct obstack& obst)
@@ -52,3 +54,48 @@ static inline void obstack_chunk_free(void* data)
   char* ptr = static_cast<char*>(data);
   delete[] ptr;
 }
+
+/** Returns uninitialized memory for count objects on the obstack.
+    Only for types that need no destructor, as the array is released
+    together with the obstack. */
+template<typename T>
+inline T*
+obstack_alloc_array(struct obstack& obst, size_t count)
+{
+  static_assert(std::is_trivially_destructible_v<T>);
+  return static_cast<T*>(obstack_alloc(&obst, static_cast<int>(sizeof(T) * count)));
+}
+
+/** Copies count objects from data into a new array on the obstack. */
+template<typename T>
+inline T*
+obstack_copy_array(struct obstack& obst, const T* data, size_t count)
+{
+  T* result = obstack_alloc_array<T>(obst, count);
+  std::uninitialized_copy_n(data, count, result);
+  return result;
+}
+
+/** Frees all objects on the obstack, but keeps its memory. When the
+    objects needed more than one chunk, the chunks are replaced by a
+    single one that is large enough for all of them, so that using the
+    obstack for the same amount of objects over and over again does
+    not allocate anymore. */
+inline void
+obstack_reset(struct obstack& obst)
+{
+  if (obst.chunk->prev)
+  {
+    long size = 0;
+    for (auto* chunk = obst.chunk; chunk; chunk = chunk->prev)
+      size += chunk->limit - reinterpret_cast<char*>(chunk);
+
+    obstack_free(&obst, nullptr);
+    obstack_begin(&obst, static_cast<int>(size));
+  }
+  else
+  {
+    obstack_free(&obst, __PTR_ALIGN(reinterpret_cast<char*>(obst.chunk), obst.chunk->contents,
+                                    obst.alignment_mask));
+  }
+}
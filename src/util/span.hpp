@@ -0,0 +1,73 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <stddef.h>
+#include <type_traits>
+#include <vector>
+
+/**
+ * A view of a contiguous array that is owned by someone else, like
+ * std::span in C++20. Used to hand arrays around without copying
+ * them into a std::vector, e.g. the geometry of the drawing requests,
+ * which lives on the obstack of the Compositor.
+ */
+template<typename T>
+class Span final
+{
+public:
+  Span() :
+    m_data(nullptr),
+    m_size(0)
+  {}
+
+  Span(T* data, size_t size) :
+    m_data(data),
+    m_size(size)
+  {}
+
+  template<typename U, typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+  Span(const Span<U>& other) :
+    m_data(other.data()),
+    m_size(other.size())
+  {}
+
+  template<typename U, typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+  Span(std::vector<U>& vector) :
+    m_data(vector.data()),
+    m_size(vector.size())
+  {}
+
+  template<typename U, typename = std::enable_if_t<std::is_convertible_v<const U(*)[], T(*)[]>>>
+  Span(const std::vector<U>& vector) :
+    m_data(vector.data()),
+    m_size(vector.size())
+  {}
+
+  inline T* data() const { return m_data; }
+  inline size_t size() const { return m_size; }
+  inline bool empty() const { return m_size == 0; }
+
+  inline T* begin() const { return m_data; }
+  inline T* end() const { return m_data + m_size; }
+
+  inline T& operator[](size_t i) const { return m_data[i]; }
+
+private:
+  T* m_data;
+  size_t m_size;
+};
@@ -0,0 +1,113 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/thread_pool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int thread_count) :
+  m_threads(),
+  m_mutex(),
+  m_job_available(),
+  m_jobs_done(),
+  m_jobs(),
+  m_running_jobs(0),
+  m_quit(false)
+{
+  if (thread_count == 0)
+    thread_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+#ifdef __EMSCRIPTEN__
+  // Without thread support, all jobs run on the calling thread.
+  thread_count = 0;
+#endif
+
+  for (unsigned int i = 0; i < thread_count; ++i)
+    m_threads.emplace_back(&ThreadPool::run, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_job_available.notify_all();
+
+  for (auto& thread : m_threads)
+    thread.join();
+}
+
+void
+ThreadPool::parallel_for(size_t count, const std::function<void(size_t, size_t)>& func)
+{
+  if (count == 0)
+    return;
+
+  const size_t ranges = std::min(count, m_threads.size() + 1);
+  const size_t range_size = (count + ranges - 1) / ranges;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (size_t begin = range_size; begin < count; begin += range_size)
+  {
+    const size_t end = std::min(begin + range_size, count);
+    m_jobs.emplace_back([&func, begin, end] { func(begin, end); });
+  }
+  lock.unlock();
+  m_job_available.notify_all();
+
+  func(0, std::min(range_size, count));
+
+  // Help with the remaining ranges, then wait for the ones in progress.
+  lock.lock();
+  while (run_job(lock)) {}
+  m_jobs_done.wait(lock, [this] { return m_jobs.empty() && m_running_jobs == 0; });
+}
+
+bool
+ThreadPool::run_job(std::unique_lock<std::mutex>& lock)
+{
+  if (m_jobs.empty())
+    return false;
+
+  std::function<void()> job = std::move(m_jobs.front());
+  m_jobs.pop_front();
+  m_running_jobs += 1;
+
+  lock.unlock();
+  job();
+  lock.lock();
+
+  m_running_jobs -= 1;
+  if (m_jobs.empty() && m_running_jobs == 0)
+    m_jobs_done.notify_all();
+
+  return true;
+}
+
+void
+ThreadPool::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    m_job_available.wait(lock, [this] { return m_quit || !m_jobs.empty(); });
+    if (m_quit)
+      return;
+
+    run_job(lock);
+  }
+}
@@ -0,0 +1,62 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** A fixed set of worker threads that jobs can be handed to. */
+class ThreadPool final
+{
+public:
+  /** Starts the given amount of worker threads, 0 starts one less
+      than the amount of hardware threads. Without thread support, no
+      workers are started and all jobs run on the calling thread. */
+  ThreadPool(unsigned int thread_count = 0);
+  ~ThreadPool();
+
+  /** Splits [0, count) into consecutive ranges and calls
+      func(begin, end) for each of them, on the worker threads and on
+      the calling thread. Returns once all ranges are done. */
+  void parallel_for(size_t count, const std::function<void(size_t, size_t)>& func);
+
+  inline size_t get_thread_count() const { return m_threads.size(); }
+
+private:
+  void run();
+
+  /** Runs one queued job, returns false if there was none. Expects
+      the lock to be held and releases it while the job runs. */
+  bool run_job(std::unique_lock<std::mutex>& lock);
+
+private:
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::condition_variable m_job_available;
+  std::condition_variable m_jobs_done;
+  std::deque<std::function<void()>> m_jobs;
+  size_t m_running_jobs;
+  bool m_quit;
+
+private:
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+};
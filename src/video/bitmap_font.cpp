@@ -36,6 +36,9 @@
 
 namespace {
 
+/** Upper limit for the amount of layouts a font keeps around */
+const size_t MAX_CACHED_LAYOUTS = 1024;
+
 bool vline_empty(const SDLSurfacePtr& surface, int x, int start_y, int end_y, Uint8 threshold)
 {
   const Uint8* pixels = static_cast<Uint8*>(surface->pixels);
@@ -64,7 +67,10 @@ BitmapFont::BitmapFont(GlyphWidth glyph_width_,
   shadowsize(shadowsize_),
   border(0),
   rtl(false),
-  glyphs(65536)
+  glyphs(65536),
+  layouts(),
+  layout_srcrects(),
+  layout_dstrects()
 {
   for (unsigned int i=0; i<65536;i++) glyphs[i].surface_idx = -1;
 
@@ -264,7 +270,7 @@ BitmapFont::~BitmapFont()
 }
 
 float
-BitmapFont::get_text_width(const std::string& text) const
+BitmapFont::measure_text_width(const std::string& text) const
 {
   float curr_width = 0;
   float last_width = 0;
@@ -311,12 +317,12 @@ BitmapFont::get_height() const
 }
 
 std::string
-BitmapFont::wrap_to_width(const std::string& s_, float width, std::string* overflow)
+BitmapFont::wrap_text_to_width(const std::string& s_, float width, std::string* overflow)
 {
   std::string s = s_;
 
   // If text is already smaller, return full text.
-  if (get_text_width(s) <= width) {
+  if (measure_text_width(s) <= width) {
     if (overflow) *overflow = "";
     return s;
   }
@@ -325,7 +331,7 @@ BitmapFont::wrap_to_width(const std::string& s_, float width, std::string* overf
   for (int i = static_cast<int>(s.length()) - 1; i >= 0; i--) {
     std::string s2 = s.substr(0,i);
     if (s[i] != ' ') continue;
-    if (get_text_width(s2) <= width) {
+    if (measure_text_width(s2) <= width) {
       if (overflow) *overflow = s.substr(i+1);
       return s.substr(0, i);
     }
@@ -347,7 +353,7 @@ BitmapFont::wrap_to_width(const std::string& s_, float width, std::string* overf
     // Check whether text now goes over allowed width, and if so
     // return everything up to the character and put the rest in the overflow.
     std::string s2 = s.substr(0,i+char_bytes);
-    if (get_text_width(s2) > width) {
+    if (measure_text_width(s2) > width) {
       if (i == 0) i += char_bytes; // Edge case when even one char is too wide.
       if (overflow) *overflow = s.substr(i);
       return s.substr(0, i);
@@ -417,13 +423,52 @@ BitmapFont::draw_text(Canvas& canvas, const std::string& text, const Vector& pos
 void
 BitmapFont::draw_chars(Canvas& canvas, bool notshadow, const std::string& text, const Vector& pos, int layer, Color color) const
 {
-  Vector p = pos;
+  const Layout& layout = get_layout(text);
+
+  for (size_t i = 0; i < layout.surface_indices.size(); ++i)
+  {
+    const SurfacePtr& surface = notshadow ?
+      glyph_surfaces[layout.surface_indices[i]] :
+      shadow_surfaces[layout.surface_indices[i]];
+
+    // Batches take rectangles on the texture, the surface may only be
+    // a part of it.
+    const Vector region(static_cast<float>(surface->get_region().left),
+                        static_cast<float>(surface->get_region().top));
+    const std::vector<Rectf>& srcrects = layout.srcrects[i];
+    const std::vector<Rectf>& dstrects = layout.dstrects[i];
+    layout_srcrects.resize(srcrects.size());
+    layout_dstrects.resize(dstrects.size());
+    for (size_t j = 0; j < srcrects.size(); ++j)
+    {
+      layout_srcrects[j] = srcrects[j].moved(region);
+      layout_dstrects[j] = dstrects[j].moved(pos);
+    }
+
+    canvas.draw_surface_batch(surface, layout_srcrects, layout_dstrects, color, layer);
+  }
+}
+
+const BitmapFont::Layout&
+BitmapFont::get_layout(const std::string& text) const
+{
+  auto cached = layouts.find(text);
+  if (cached != layouts.end())
+    return cached->second;
+
+  // Text that changes every frame would fill the cache, start over
+  // once it gets large.
+  if (layouts.size() >= MAX_CACHED_LAYOUTS)
+    layouts.clear();
+
+  Layout& layout = layouts[text];
+  Vector p(0.0f, 0.0f);
 
   for (UTF8Iterator it(text); !it.done(); ++it)
   {
     if (*it == '\n')
     {
-      p.x = pos.x;
+      p.x = 0.0f;
       p.y += static_cast<float>(char_height) + 2.0f;
     }
     else if (*it == ' ')
@@ -438,16 +483,21 @@ BitmapFont::draw_chars(Canvas& canvas, bool notshadow, const std::string& text,
       else
         glyph = glyphs[0x20];
 
-      // FIXME: not supported! request.color = color;
-      canvas.draw_surface_part(notshadow ?
-                               glyph_surfaces[glyph.surface_idx] :
-                               shadow_surfaces[glyph.surface_idx],
-                               glyph.rect,
-                               Rectf(p + glyph.offset, glyph.rect.get_size()),
-                               layer,
-                               PaintStyle().set_color(color));
+      auto group = std::find(layout.surface_indices.begin(), layout.surface_indices.end(), glyph.surface_idx);
+      if (group == layout.surface_indices.end())
+      {
+        layout.surface_indices.push_back(glyph.surface_idx);
+        layout.srcrects.emplace_back();
+        layout.dstrects.emplace_back();
+        group = layout.surface_indices.end() - 1;
+      }
+      const size_t i = static_cast<size_t>(group - layout.surface_indices.begin());
+      layout.srcrects[i].push_back(glyph.rect);
+      layout.dstrects[i].emplace_back(p + glyph.offset, glyph.rect.get_size());
 
       p.x += glyph.advance;
     }
   }
+
+  return layout;
 }
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "math/rectf.hpp"
 #include "math/vector.hpp"
@@ -48,13 +50,6 @@ public:
 
   inline int get_shadow_size() const { return shadowsize; }
 
-  /** returns the width of a given text. (Note that I won't add a normal
-   * get_width function here, as we might switch to variable width fonts in the
-   * future.)
-   * Supports breaklines.
-   */
-  virtual float get_text_width(const std::string& text) const override;
-
   /** returns the height of a given text. This function supports breaklines.
    * In case, you are positive that your text doesn't use break lines, you can
    * just use get_height().
@@ -66,13 +61,21 @@ public:
    */
   virtual float get_height() const override;
 
+  virtual Rectf draw_text(Canvas& canvas, const std::string& text,
+                          const Vector& pos, FontAlignment alignment, int layer, const Color& color) override;
+
+protected:
+  /** returns the width of a given text. (Note that I won't add a normal
+   * get_width function here, as we might switch to variable width fonts in the
+   * future.)
+   * Supports breaklines.
+   */
+  virtual float measure_text_width(const std::string& text) const override;
+
   /**
    * returns the given string, truncated (preferably at whitespace) to be at most "width" pixels wide
    */
-  virtual std::string wrap_to_width(const std::string& text, float width, std::string* overflow) override;
-
-  virtual Rectf draw_text(Canvas& canvas, const std::string& text,
-                          const Vector& pos, FontAlignment alignment, int layer, const Color& color) override;
+  virtual std::string wrap_text_to_width(const std::string& text, float width, std::string* overflow) override;
 
 private:
   friend class DrawingContext;
@@ -83,6 +86,12 @@ private:
   void draw_chars(Canvas& painter, bool nonshadow, const std::string& text,
                   const Vector& position, int layer, Color color) const;
 
+  struct Layout;
+
+  /** Returns the glyphs of text, laid out from (0, 0). Layouts are
+      cached, as most text is drawn unchanged for many frames. */
+  const Layout& get_layout(const std::string& text) const;
+
   void loadFontFile(const std::string &filename);
   void loadFontSurface(const std::string &glyphimage,
                        const std::string &shadowimage,
@@ -112,6 +121,17 @@ private:
     {}
   };
 
+  /** The glyphs of a line of text, grouped by the surface they are
+      on, so that each group can be drawn with a single request. */
+  struct Layout {
+    std::vector<int> surface_indices;
+
+    /** Positions of the glyphs on the surface */
+    std::vector<std::vector<Rectf>> srcrects;
+
+    std::vector<std::vector<Rectf>> dstrects;
+  };
+
 private:
   GlyphWidth glyph_width;
 
@@ -124,4 +144,10 @@ private:
 
   /** 65536 of glyphs */
   std::vector<Glyph> glyphs;
+
+  mutable std::unordered_map<std::string, Layout> layouts;
+
+  /** Scratch space for moving the rectangles of a layout into place */
+  mutable std::vector<Rectf> layout_srcrects;
+  mutable std::vector<Rectf> layout_dstrects;
 };
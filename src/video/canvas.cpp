@@ -18,6 +18,9 @@
 
 #include <algorithm>
 #include <array>
+#include <assert.h>
+#include <limits>
+#include <memory>
 
 #include "supertux/globals.hpp"
 #include "supertux/gameconfig.hpp"
@@ -26,17 +29,57 @@
 #include "video/drawing_context.hpp"
 #include "video/drawing_request.hpp"
 #include "video/painter.hpp"
+#include "video/render_stats.hpp"
 #include "video/renderer.hpp"
 #include "video/surface.hpp"
 #include "video/video_system.hpp"
 
-Canvas::Canvas(DrawingContext& context, obstack& obst) :
+namespace {
+
+/** Adds the bytes of value to an FNV-1a hash. Only for types without
+    padding. */
+template<typename T>
+void hash_value(uint64_t& hash, const T& value)
+{
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+  for (size_t i = 0; i < sizeof(T); ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+}
+
+void hash_value(uint64_t& hash, const Rectf& rect)
+{
+  hash_value(hash, rect.get_left());
+  hash_value(hash, rect.get_top());
+  hash_value(hash, rect.get_width());
+  hash_value(hash, rect.get_height());
+}
+
+void hash_value(uint64_t& hash, const Color& color)
+{
+  hash_value(hash, color.red);
+  hash_value(hash, color.green);
+  hash_value(hash, color.blue);
+  hash_value(hash, color.alpha);
+}
+
+void hash_value(uint64_t& hash, const Vector& vector)
+{
+  hash_value(hash, vector.x);
+  hash_value(hash, vector.y);
+}
+
+} // namespace
+
+Canvas::Canvas(DrawingContext& context, obstack& obst, bool world_space) :
   m_context(context),
   m_obst(obst),
-  m_requests(),
-  m_blur(0)
+  m_world_space(world_space),
+  m_blur(0),
+  m_requests()
 {
-  m_requests.reserve(500);
 }
 
 Canvas::~Canvas()
@@ -47,55 +90,89 @@ Canvas::~Canvas()
 void
 Canvas::clear()
 {
-  for (const auto& request : m_requests)
-  {
+  m_requests.for_each([](DrawingRequest* request) {
     request->~DrawingRequest();
-  }
+  });
   m_requests.clear();
 }
 
 void
 Canvas::render(Renderer& renderer, Filter filter)
 {
-  // On a regular level, each frame has around 50-250 requests (before
-  // batching it was 1000-3000), the sort comparator function is
-  // called approximatly 3-7 times for each request.
-  std::stable_sort(m_requests.begin(), m_requests.end(),
-                   [](const DrawingRequest* r1, const DrawingRequest* r2){
-                     return r1->layer < r2->layer;
-                   });
+  switch (filter)
+  {
+    case BELOW_LIGHTMAP:
+      render(renderer, std::numeric_limits<int>::min(), LAYER_LIGHTMAP - 1);
+      break;
+
+    case ABOVE_LIGHTMAP:
+      render(renderer, LAYER_LIGHTMAP + 1, std::numeric_limits<int>::max());
+      break;
+
+    case ALL:
+      render(renderer, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+      break;
+  }
+}
+
+void
+Canvas::render(Renderer& renderer, int min_layer, int max_layer)
+{
+  // The requests are already in the order of their layers, see
+  // LayerBuckets, so no sorting is needed.
+  merge_requests();
 
   Painter& painter = renderer.get_painter();
+  RenderStats& stats = RenderStats::current();
+  const DrawingRequest* previous = nullptr;
 
-  for (const auto& i : m_requests)
+  for (const auto& bucket : m_requests.get_buckets())
   {
-    const DrawingRequest& request = *i;
-
-    if (filter == BELOW_LIGHTMAP && request.layer >= LAYER_LIGHTMAP)
-      continue;
-    else if (filter == ABOVE_LIGHTMAP && request.layer <= LAYER_LIGHTMAP)
+    if (bucket.layer > max_layer)
+      break;
+    else if (bucket.layer < min_layer)
       continue;
 
-    painter.set_clip_rect(request.viewport);
+    if (!bucket.items.empty())
+      stats.add_layer_requests(bucket.layer, static_cast<int>(bucket.items.size()));
 
-    std::visit([&request, &painter](auto&& arg)
+    for (const auto& i : bucket.items)
     {
-      using T = std::decay_t<decltype(arg)>;
-      if constexpr (std::is_same_v<T, TextureRequest>)
-        painter.draw_texture(request);
-      else if constexpr (std::is_same_v<T, GradientRequest>)
-        painter.draw_gradient(request);
-      else if constexpr (std::is_same_v<T, FillRectRequest>)
-        painter.draw_filled_rect(request);
-      else if constexpr (std::is_same_v<T, InverseEllipseRequest>)
-        painter.draw_inverse_ellipse(request);
-      else if constexpr (std::is_same_v<T, LineRequest>)
-        painter.draw_line(request);
-      else if constexpr (std::is_same_v<T, TriangleRequest>)
-        painter.draw_triangle(request);
-      else if constexpr (std::is_same_v<T, GetPixelRequest>)
-        painter.get_pixel(request);
-    }, request.request);
+      const DrawingRequest& request = *i;
+
+      stats.requests += 1;
+      if (!previous || previous->request.index() != request.request.index() ||
+          previous->blend != request.blend || !(previous->viewport == request.viewport) ||
+          (std::holds_alternative<TextureRequest>(request.request) &&
+           std::get<TextureRequest>(previous->request).texture != std::get<TextureRequest>(request.request).texture))
+      {
+        stats.state_changes += 1;
+      }
+      previous = &request;
+
+      // World space requests don't know the viewport they end up in.
+      if (!m_world_space)
+        painter.set_clip_rect(request.viewport);
+
+      std::visit([&request, &painter](auto&& arg)
+      {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, TextureRequest>)
+          painter.draw_texture(request);
+        else if constexpr (std::is_same_v<T, GradientRequest>)
+          painter.draw_gradient(request);
+        else if constexpr (std::is_same_v<T, FillRectRequest>)
+          painter.draw_filled_rect(request);
+        else if constexpr (std::is_same_v<T, InverseEllipseRequest>)
+          painter.draw_inverse_ellipse(request);
+        else if constexpr (std::is_same_v<T, LineRequest>)
+          painter.draw_line(request);
+        else if constexpr (std::is_same_v<T, TriangleRequest>)
+          painter.draw_triangle(request);
+        else if constexpr (std::is_same_v<T, GetPixelRequest>)
+          painter.get_pixel(request);
+      }, request.request);
+    }
   }
 
   painter.clear_clip_rect();
@@ -110,11 +187,13 @@ Canvas::draw_surface(const SurfacePtr& surface,
 
   const auto& cliprect = m_context.get_cliprect();
 
-  // Discard clipped surface.
-  if (position.x > cliprect.get_right() ||
+  // Discard clipped surface. Surfaces in world space are kept, they
+  // may become visible without being drawn again.
+  if (!m_world_space &&
+     (position.x > cliprect.get_right() ||
      position.y > cliprect.get_bottom() ||
      position.x + static_cast<float>(surface->get_width()) < cliprect.get_left() ||
-     position.y + static_cast<float>(surface->get_height()) < cliprect.get_top())
+     position.y + static_cast<float>(surface->get_height()) < cliprect.get_top()))
     return;
 
   auto req = new(m_obst) DrawingRequest(m_context.transform());
@@ -125,16 +204,17 @@ Canvas::draw_surface(const SurfacePtr& surface,
 
   req->request = TextureRequest{};
   auto&& req_var = std::get<TextureRequest>(req->request);
-  req_var.srcrects.emplace_back(Rectf(surface->get_region()));
-  req_var.dstrects.emplace_back(Rectf(apply_translate(position) * scale(),
-                                 Sizef(static_cast<float>(surface->get_width()) * scale(),
-                                       static_cast<float>(surface->get_height()) * scale())));
-  req_var.angles.emplace_back(angle);
+  const Rectf srcrect(surface->get_region());
+  const Rectf dstrect(apply_translate(position) * scale(),
+                      Sizef(static_cast<float>(surface->get_width()) * scale(),
+                            static_cast<float>(surface->get_height()) * scale()));
+  set_texture_geometry(req_var, m_obst, Span<const Rectf>(&srcrect, 1), Span<const Rectf>(&dstrect, 1),
+                       Span<const float>(&angle, 1));
   req_var.texture = surface->get_texture().get();
   req_var.displacement_texture = surface->get_displacement_texture().get();
   req_var.color = color;
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
@@ -166,41 +246,41 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
 
   req->request = TextureRequest{};
   auto&& req_var = std::get<TextureRequest>(req->request);
-  req_var.srcrects.emplace_back(srcrect);
-  req_var.dstrects.emplace_back(apply_translate(dstrect.p1())*scale(), dstrect.get_size()*scale());
-  req_var.angles.emplace_back(0.0f);
+  const Rectf region_srcrect = srcrect.moved(Vector(static_cast<float>(surface->get_region().left),
+                                                   static_cast<float>(surface->get_region().top)));
+  const Rectf scaled_dstrect(apply_translate(dstrect.p1())*scale(), dstrect.get_size()*scale());
+  set_texture_geometry(req_var, m_obst, Span<const Rectf>(&region_srcrect, 1),
+                       Span<const Rectf>(&scaled_dstrect, 1), Span<const float>());
   req_var.texture = surface->get_texture().get();
   req_var.displacement_texture = surface->get_displacement_texture().get();
   req_var.color = style.get_color();
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
 Canvas::draw_surface_batch(const SurfacePtr& surface,
-                           std::vector<Rectf> srcrects,
-                           std::vector<Rectf> dstrects,
+                           Span<const Rectf> srcrects,
+                           Span<const Rectf> dstrects,
                            const Color& color,
                            int layer)
 {
-  const size_t len = srcrects.size();
-  draw_surface_batch(surface,
-                     std::move(srcrects),
-                     std::move(dstrects),
-                     std::vector<float>(len, 0.0f),
-                     color, layer);
+  draw_surface_batch(surface, srcrects, dstrects, Span<const float>(), color, layer);
 }
 
 void
 Canvas::draw_surface_batch(const SurfacePtr& surface,
-                           std::vector<Rectf> srcrects,
-                           std::vector<Rectf> dstrects,
-                           std::vector<float> angles,
+                           Span<const Rectf> srcrects,
+                           Span<const Rectf> dstrects,
+                           Span<const float> angles,
                            const Color& color,
                            int layer)
 {
   if (!surface) return;
 
+  assert(srcrects.size() == dstrects.size());
+  assert(angles.empty() || angles.size() == srcrects.size());
+
   auto req = new(m_obst) DrawingRequest(m_context.transform());
 
   req->layer = std::min(layer, m_context.transform().max_layer);
@@ -210,9 +290,7 @@ Canvas::draw_surface_batch(const SurfacePtr& surface,
   auto&& req_var = std::get<TextureRequest>(req->request);
   req_var.color = color;
 
-  req_var.srcrects = std::move(srcrects);
-  req_var.dstrects = std::move(dstrects);
-  req_var.angles = std::move(angles);
+  set_texture_geometry(req_var, m_obst, srcrects, dstrects, angles);
 
   for (auto& dstrect : req_var.dstrects)
   {
@@ -222,7 +300,7 @@ Canvas::draw_surface_batch(const SurfacePtr& surface,
   req_var.texture = surface->get_texture().get();
   req_var.displacement_texture = surface->get_displacement_texture().get();
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 Rectf
@@ -259,7 +337,7 @@ Canvas::draw_gradient(const Color& top, const Color& bottom, int layer,
   req_var.region = Rectf(apply_translate(region.p1())*scale(),
                          apply_translate(region.p2())*scale());
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
@@ -293,7 +371,7 @@ Canvas::draw_filled_rect(const Rectf& rect, const Color& color, float radius, in
   req_var.radius = radius;
   req_var.blur = g_config->fancy_gfx ? m_blur : 0;
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
@@ -310,7 +388,7 @@ Canvas::draw_inverse_ellipse(const Vector& pos, const Vector& size, const Color&
   req_var.color.alpha  = color.alpha * m_context.transform().alpha;
   req_var.size         = size*scale();
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
@@ -327,7 +405,7 @@ Canvas::draw_line(const Vector& pos1, const Vector& pos2, const Color& color, in
   req_var.color.alpha  = color.alpha * m_context.transform().alpha;
   req_var.dest_pos     = apply_translate(pos2)*scale();
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
@@ -345,7 +423,7 @@ Canvas::draw_triangle(const Vector& pos1, const Vector& pos2, const Vector& pos3
   req_var.color = color;
   req_var.color.alpha = color.alpha * m_context.transform().alpha;
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
 }
 
 void
@@ -393,19 +471,216 @@ Canvas::get_pixel(const Vector& position, const std::shared_ptr<Color>& color_ou
   req_var.pos = pos;
   req_var.color_ptr = color_out;
 
-  m_requests.push_back(req);
+  m_requests.push_back(req->layer, req);
+}
+
+void
+Canvas::merge_requests()
+{
+  for (auto& bucket : m_requests.get_buckets())
+  {
+    RenderStats::current().merged_requests += merge_drawing_requests(bucket.items, m_obst);
+  }
+}
+
+bool
+Canvas::get_layers(int& min_layer, int& max_layer) const
+{
+  bool found = false;
+  for (const auto& bucket : m_requests.get_buckets())
+  {
+    if (bucket.items.empty())
+      continue;
+
+    if (!found)
+      min_layer = bucket.layer;
+    max_layer = bucket.layer;
+    found = true;
+  }
+  return found;
+}
+
+bool
+Canvas::is_additive(int min_layer, int max_layer) const
+{
+  for (const auto& bucket : m_requests.get_buckets())
+  {
+    if (bucket.layer > max_layer)
+      break;
+    else if (bucket.layer < min_layer)
+      continue;
+
+    for (const auto* request : bucket.items)
+    {
+      if (request->blend != Blend::ADD)
+        return false;
+    }
+  }
+  return true;
+}
+
+void
+Canvas::take_requests(Canvas& other)
+{
+  assert(&m_obst == &other.m_obst);
+
+  other.m_requests.for_each([this](DrawingRequest* request) {
+    m_requests.push_back(request->layer, request);
+  });
+
+  // The requests belong to this canvas now, so they must not be
+  // destroyed by other.clear().
+  other.m_requests.clear();
+}
+
+uint64_t
+Canvas::get_fingerprint() const
+{
+  uint64_t hash = 14695981039346656037ull;
+  m_requests.for_each([&hash](const DrawingRequest* request) {
+    hash_value(hash, request->layer);
+    hash_value(hash, request->flip);
+    hash_value(hash, request->alpha);
+    hash_value(hash, request->blend);
+    hash_value(hash, request->request.index());
+
+    std::visit([&hash](auto&& arg)
+    {
+      using T = std::decay_t<decltype(arg)>;
+      if constexpr (std::is_same_v<T, TextureRequest>)
+      {
+        hash_value(hash, arg.texture);
+        hash_value(hash, arg.displacement_texture);
+        hash_value(hash, arg.color);
+        for (size_t i = 0; i < arg.srcrects.size(); ++i)
+        {
+          hash_value(hash, arg.srcrects[i]);
+          hash_value(hash, arg.dstrects[i]);
+          hash_value(hash, arg.angles[i]);
+        }
+      }
+      else if constexpr (std::is_same_v<T, GradientRequest>)
+      {
+        hash_value(hash, arg.pos);
+        hash_value(hash, arg.size);
+        hash_value(hash, arg.top);
+        hash_value(hash, arg.bottom);
+        hash_value(hash, arg.direction);
+        hash_value(hash, arg.region);
+      }
+      else if constexpr (std::is_same_v<T, FillRectRequest>)
+      {
+        hash_value(hash, arg.rect);
+        hash_value(hash, arg.color);
+        hash_value(hash, arg.radius);
+        hash_value(hash, arg.blur);
+      }
+      else if constexpr (std::is_same_v<T, InverseEllipseRequest>)
+      {
+        hash_value(hash, arg.pos);
+        hash_value(hash, arg.size);
+        hash_value(hash, arg.color);
+      }
+      else if constexpr (std::is_same_v<T, LineRequest>)
+      {
+        hash_value(hash, arg.pos);
+        hash_value(hash, arg.dest_pos);
+        hash_value(hash, arg.color);
+      }
+      else if constexpr (std::is_same_v<T, TriangleRequest>)
+      {
+        hash_value(hash, arg.pos1);
+        hash_value(hash, arg.pos2);
+        hash_value(hash, arg.pos3);
+        hash_value(hash, arg.color);
+      }
+      else if constexpr (std::is_same_v<T, GetPixelRequest>)
+      {
+        hash_value(hash, arg.pos);
+      }
+    }, request->request);
+  });
+  return hash;
+}
+
+void
+Canvas::transform_requests(const Vector& offset, float scale)
+{
+  auto apply = [&offset, scale](const Vector& pos) { return (pos - offset) * scale; };
+
+  m_requests.for_each([&apply, scale](DrawingRequest* request) {
+    std::visit([&apply, scale](auto&& arg)
+    {
+      using T = std::decay_t<decltype(arg)>;
+      if constexpr (std::is_same_v<T, TextureRequest>)
+      {
+        for (auto& dstrect : arg.dstrects)
+          dstrect = Rectf(apply(dstrect.p1()), dstrect.get_size() * scale);
+      }
+      else if constexpr (std::is_same_v<T, GradientRequest>)
+      {
+        arg.pos = apply(arg.pos);
+        arg.size *= scale;
+        arg.region = Rectf(apply(arg.region.p1()), apply(arg.region.p2()));
+      }
+      else if constexpr (std::is_same_v<T, FillRectRequest>)
+      {
+        arg.rect = Rectf(apply(arg.rect.p1()), arg.rect.get_size() * scale);
+        arg.radius *= scale;
+      }
+      else if constexpr (std::is_same_v<T, InverseEllipseRequest>)
+      {
+        arg.pos = apply(arg.pos);
+        arg.size *= scale;
+      }
+      else if constexpr (std::is_same_v<T, LineRequest>)
+      {
+        arg.pos = apply(arg.pos);
+        arg.dest_pos = apply(arg.dest_pos);
+      }
+      else if constexpr (std::is_same_v<T, TriangleRequest>)
+      {
+        arg.pos1 = apply(arg.pos1);
+        arg.pos2 = apply(arg.pos2);
+        arg.pos3 = apply(arg.pos3);
+      }
+      else if constexpr (std::is_same_v<T, GetPixelRequest>)
+      {
+        arg.pos = apply(arg.pos);
+      }
+    }, request->request);
+  });
 }
 
 Vector
 Canvas::apply_translate(const Vector& pos) const
 {
-  const Vector& translation = m_context.transform().translation;
-  return (pos - translation) + Vector(static_cast<float>(m_context.get_viewport().left),
-                                      static_cast<float>(m_context.get_viewport().top));
+  const DrawingTransform& transform = m_context.transform();
+  const Vector screen_pos = (pos - transform.translation) +
+                            Vector(static_cast<float>(transform.viewport.left),
+                                   static_cast<float>(transform.viewport.top));
+  if (!m_world_space)
+    return screen_pos;
+
+  // Keep the positions exact for the usual case, or the fingerprint of
+  // the static lights would change whenever the camera moves.
+  const DrawingTransform& world = m_context.get_static_light_transform();
+  if (transform.translation == world.translation && transform.scale == world.scale &&
+      transform.viewport.left == world.viewport.left && transform.viewport.top == world.viewport.top)
+    return pos;
+
+  // Multiplied with scale(), this is the world position that world
+  // draws at the screen position that transform draws pos at.
+  return screen_pos + (world.translation - Vector(static_cast<float>(world.viewport.left),
+                                                  static_cast<float>(world.viewport.top))) *
+                      (world.scale / transform.scale);
 }
 
 float
 Canvas::scale() const
 {
+  if (m_world_space)
+    return m_context.transform().scale / m_context.get_static_light_transform().scale;
+
   return m_context.transform().scale;
 }
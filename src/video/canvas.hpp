@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <stdint.h>
 #include <string>
 #include <vector>
 #include <memory>
@@ -24,6 +25,7 @@
 
 #include "math/rectf.hpp"
 #include "math/vector.hpp"
+#include "util/span.hpp"
 #include "video/blend.hpp"
 #include "video/color.hpp"
 #include "video/drawing_target.hpp"
@@ -32,6 +34,7 @@
 #include "video/gl.hpp"
 #include "video/gradient.hpp"
 #include "video/layer.hpp"
+#include "video/layer_buckets.hpp"
 #include "video/paint_style.hpp"
 
 class DrawingContext;
@@ -45,25 +48,34 @@ public:
   enum Filter { BELOW_LIGHTMAP, ABOVE_LIGHTMAP, ALL };
 
 public:
-  Canvas(DrawingContext& context, obstack& obst);
+  /** If world_space is true, the requests are kept in world
+      coordinates instead of screen coordinates, that is without the
+      translation and scale of
+      DrawingContext::get_static_light_transform(). Requests made with
+      another transform are moved to where that transform would draw
+      them. */
+  Canvas(DrawingContext& context, obstack& obst, bool world_space = false);
   ~Canvas();
   
   void draw_surface(const SurfacePtr& surface, const Vector& position, int layer);
   void draw_surface(const SurfacePtr& surface, const Vector& position, float angle, const Color& color, const Blend& blend,
                     int layer);
+  /** srcrect is relative to the top left corner of the surface. */
   void draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const Rectf& dstrect,
                          int layer, const PaintStyle& style = PaintStyle());
   void draw_surface_scaled(const SurfacePtr& surface, const Rectf& dstrect,
                            int layer, const PaintStyle& style = PaintStyle());
+  /** The rectangles are copied, so they only need to stay valid
+      during the call. */
   void draw_surface_batch(const SurfacePtr& surface,
-                          std::vector<Rectf> srcrects,
-                          std::vector<Rectf> dstrects,
+                          Span<const Rectf> srcrects,
+                          Span<const Rectf> dstrects,
                           const Color& color,
                           int layer);
   void draw_surface_batch(const SurfacePtr& surface,
-                          std::vector<Rectf> srcrects,
-                          std::vector<Rectf> dstrects,
-                          std::vector<float> angles,
+                          Span<const Rectf> srcrects,
+                          Span<const Rectf> dstrects,
+                          Span<const float> angles,
                           const Color& color,
                           int layer);
   Rectf draw_text(const FontPtr& font, const std::string& text,
@@ -98,20 +110,51 @@ public:
 
   void clear();
   void render(Renderer& renderer, Filter filter);
+  /** Renders the requests of the layers from min_layer to max_layer. */
+  void render(Renderer& renderer, int min_layer, int max_layer);
+
+  inline bool empty() const { return m_requests.empty(); }
+
+  /** Sets min_layer and max_layer to the lowest and highest layer
+      with requests, returns false if there are none. */
+  bool get_layers(int& min_layer, int& max_layer) const;
+
+  /** Returns true if all requests of the layers from min_layer to
+      max_layer are added onto the target, that is if they can be
+      drawn in any order. */
+  bool is_additive(int min_layer, int max_layer) const;
+
+  /** Moves the requests of other into this canvas, behind the
+      requests of the same layer. Both canvases have to belong to the
+      same DrawingContext, as the requests stay on its obstack. */
+  void take_requests(Canvas& other);
+
+  /** Returns a hash of all requests, equal fingerprints of two frames
+      mean that they would draw the same. */
+  uint64_t get_fingerprint() const;
+
+  /** Moves all requests by -offset and scales them afterwards, used to
+      bring world space requests to the place they are drawn to. */
+  void transform_requests(const Vector& offset, float scale);
   
   void set_blur(int blur) { m_blur = blur; }
 
   inline DrawingContext& get_context() { return m_context; }
 
 private:
+  /** Merges consecutive texture requests that can be drawn together,
+      expects the requests to be sorted. */
+  void merge_requests();
+
   Vector apply_translate(const Vector& pos) const;
   float scale() const;
 
 private:
   DrawingContext& m_context;
   obstack& m_obst;
+  bool m_world_space;
   int m_blur;
-  std::vector<DrawingRequest*> m_requests;
+  LayerBuckets<DrawingRequest*> m_requests;
 
 private:
   Canvas(const Canvas&) = delete;
@@ -17,20 +17,27 @@
 
 #include "video/compositor.hpp"
 
+#include <SDL3/SDL.h>
+#include <limits>
+
 #include "math/rect.hpp"
 #include "video/drawing_context.hpp"
 #include "video/drawing_request.hpp"
 #include "video/painter.hpp"
+#include "video/render_stats.hpp"
 #include "video/renderer.hpp"
 #include "video/video_system.hpp"
+#include "video/viewport.hpp"
 
 bool Compositor::s_render_lighting = true;
 
-Compositor::Compositor(VideoSystem& video_system, float time_offset) :
+Compositor::Compositor(VideoSystem& video_system) :
   m_video_system(video_system),
   m_obst(),
   m_drawing_contexts(),
-  m_time_offset(time_offset)
+  m_unused_contexts(),
+  m_time_offset(0.0f),
+  m_static_lights()
 {
   obstack_init(&m_obst);
 }
@@ -38,19 +45,32 @@ Compositor::Compositor(VideoSystem& video_system, float time_offset) :
 Compositor::~Compositor()
 {
   m_drawing_contexts.clear();
+  m_unused_contexts.clear();
   obstack_free(&m_obst, nullptr);
 }
 
 DrawingContext&
 Compositor::make_context(bool overlay)
 {
-  m_drawing_contexts.emplace_back(new DrawingContext(m_video_system, m_obst, overlay, m_time_offset));
+  if (m_unused_contexts.empty())
+  {
+    m_drawing_contexts.emplace_back(new DrawingContext(m_video_system, m_obst, overlay, m_time_offset));
+  }
+  else
+  {
+    m_drawing_contexts.push_back(std::move(m_unused_contexts.back()));
+    m_unused_contexts.pop_back();
+    m_drawing_contexts.back()->reset(overlay, m_time_offset);
+  }
   return *m_drawing_contexts.back();
 }
 
 void
 Compositor::render()
 {
+  const Uint64 start_ticks = SDL_GetTicksNS();
+  RenderStats& stats = RenderStats::current();
+
   auto& lightmap = m_video_system.get_lightmap();
 
   bool use_lightmap = std::any_of(m_drawing_contexts.begin(), m_drawing_contexts.end(),
@@ -63,6 +83,30 @@ Compositor::render()
   // Prepare lightmap.
   if (use_lightmap)
   {
+    // The static lights of the first context that has some are kept in
+    // a texture, it has to be updated before the lightmap is drawn. The
+    // texture is drawn at the lowest layer of the static lights, which
+    // only gives the same result as drawing them one by one if the
+    // dynamic lights in between are additive as well. Alpha blended
+    // requests there, like lightmap tilemaps, disable the cache.
+    auto& static_lightmap = m_video_system.get_static_lightmap();
+    DrawingContext* cached_ctx = nullptr;
+    int min_layer = 0;
+    int max_layer = 0;
+    for (auto& ctx : m_drawing_contexts)
+    {
+      if (!ctx->is_overlay() &&
+          ctx->get_static_light_canvas().get_layers(min_layer, max_layer))
+      {
+        if (ctx->light().is_additive(min_layer, max_layer))
+          cached_ctx = ctx.get();
+        break;
+      }
+    }
+
+    if (cached_ctx && m_static_lights.update(*cached_ctx, static_lightmap))
+      stats.static_light_updates += 1;
+
     lightmap.start_draw();
     Painter& painter = lightmap.get_painter();
 
@@ -72,7 +116,27 @@ Compositor::render()
       {
         painter.clear(ctx->get_ambient_color());
 
-        ctx->light().render(lightmap, Canvas::ALL);
+        if (ctx.get() == cached_ctx)
+        {
+          ctx->light().render(lightmap, std::numeric_limits<int>::min(), min_layer - 1);
+          m_static_lights.draw(*ctx, static_lightmap, painter);
+          ctx->light().render(lightmap, min_layer, std::numeric_limits<int>::max());
+        }
+        else
+        {
+          // Any other context draws its static lights in the layers
+          // they were drawn to, like the dynamic lights.
+          const DrawingTransform& transform = ctx->get_static_light_transform();
+          Canvas& static_lights = ctx->get_static_light_canvas();
+          static_lights.transform_requests(transform.translation -
+                                           Vector(static_cast<float>(transform.viewport.left),
+                                                  static_cast<float>(transform.viewport.top)),
+                                           transform.scale);
+          ctx->light().take_requests(static_lights);
+          ctx->light().render(lightmap, Canvas::ALL);
+        }
+
+        stats.lightmap_passes += 1;
       }
     }
     lightmap.end_draw();
@@ -113,11 +177,14 @@ Compositor::render()
 
         request.blend = Blend::MOD;
 
-        req_var.srcrects.emplace_back(0.0f, 0.0f,
-                                      static_cast<float>(texture->get_image_width()),
-                                      static_cast<float>(texture->get_image_height()));
-        req_var.dstrects.emplace_back(Vector(0.0f, 0.0f), lightmap.get_logical_size());
-        req_var.angles.emplace_back(0.0f);
+        Rectf srcrect(0.0f, 0.0f,
+                      static_cast<float>(texture->get_image_width()),
+                      static_cast<float>(texture->get_image_height()));
+        Rectf dstrect(Vector(0.0f, 0.0f), lightmap.get_logical_size());
+        float angle = 0.0f;
+        req_var.srcrects = Span<Rectf>(&srcrect, 1);
+        req_var.dstrects = Span<Rectf>(&dstrect, 1);
+        req_var.angles = Span<float>(&angle, 1);
 
         req_var.texture = texture.get();
         req_var.color = Color::WHITE;
@@ -135,13 +202,23 @@ Compositor::render()
     renderer.end_draw();
   }
 
-  // Clean up.
+  // Clean up, the contexts and the memory of the requests are reused
+  // in the next frame.
   for (auto& ctx : m_drawing_contexts)
   {
     ctx->clear();
+    m_unused_contexts.push_back(std::move(ctx));
   }
+  m_drawing_contexts.clear();
+
+  const Rect& viewport = m_video_system.get_viewport().get_rect();
+  stats.screen_pixels = static_cast<float>(viewport.get_width()) * static_cast<float>(viewport.get_height());
+  stats.render_time = static_cast<float>(SDL_GetTicksNS() - start_ticks) / 1000000.0f;
+
   m_video_system.flip();
 
-  obstack_free(&m_obst, nullptr);
-  obstack_init(&m_obst);
+  obstack_reset(m_obst);
+
+  // The counters cover one frame, they are shown while drawing the next.
+  RenderStats::end_frame();
 }
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "util/obstackpp.hpp"
+#include "video/static_light_cache.hpp"
 
 class DrawingContext;
 class Rect;
@@ -32,11 +33,17 @@ public:
   static bool s_render_lighting;
 
 public:
-  Compositor(VideoSystem& video_system, float time_offset);
+  Compositor(VideoSystem& video_system);
   ~Compositor();
 
+  /** Draws the contexts that were made since the last call and
+      clears them. */
   void render();
 
+  /** For position extrapolation at high frame rates, passed on to the
+      contexts made afterwards */
+  inline void set_time_offset(float time_offset) { m_time_offset = time_offset; }
+
   /** Create a DrawingContext, if overlay is true the context will not
       feature light rendering. This is required for contexts that
       overlap with other context (e.g. the HUD in ScreenManager) as
@@ -51,8 +58,14 @@ private:
 
   std::vector<std::unique_ptr<DrawingContext> > m_drawing_contexts;
 
+  /** Contexts of previous frames, kept so that they don't need to be
+      allocated again */
+  std::vector<std::unique_ptr<DrawingContext> > m_unused_contexts;
+
   float m_time_offset;
 
+  StaticLightCache m_static_lights;
+
 private:
   Compositor(const Compositor&) = delete;
   Compositor& operator=(const Compositor&) = delete;
@@ -34,6 +34,9 @@ DrawingContext::DrawingContext(VideoSystem& video_system_, obstack& obst, bool o
   m_transform_stack({ DrawingTransform(m_video_system.get_viewport()) }),
   m_colormap_canvas(*this, m_obst),
   m_lightmap_canvas(*this, m_obst),
+  m_static_lightmap_canvas(*this, m_obst, true),
+  m_static_light_transform(m_video_system.get_viewport()),
+  m_has_static_light_transform(false),
   m_time_offset(time_offset)
 {
 }
@@ -43,9 +46,27 @@ DrawingContext::~DrawingContext()
   clear();
 }
 
+void
+DrawingContext::reset(bool overlay, float time_offset)
+{
+  clear();
+
+  m_overlay = overlay;
+  m_ambient_color = Color::WHITE;
+  m_transform_stack.clear();
+  m_transform_stack.emplace_back(m_video_system.get_viewport());
+  m_colormap_canvas.set_blur(0);
+  m_lightmap_canvas.set_blur(0);
+  m_static_lightmap_canvas.set_blur(0);
+  m_static_light_transform = DrawingTransform(m_video_system.get_viewport());
+  m_time_offset = time_offset;
+}
+
 void
 DrawingContext::clear()
 {
+  m_static_lightmap_canvas.clear();
+  m_has_static_light_transform = false;
   m_lightmap_canvas.clear();
   m_colormap_canvas.clear();
 }
@@ -59,6 +80,20 @@ DrawingContext::get_cliprect() const
                get_translation().y + static_cast<float>(transform().viewport.get_height()) / transform().scale);
 }
 
+Canvas&
+DrawingContext::static_light()
+{
+  assert(!m_overlay);
+  // The static lights are kept relative to the first transform of the
+  // frame, requests made with other transforms are moved to match it.
+  if (!m_has_static_light_transform)
+  {
+    m_static_light_transform = transform();
+    m_has_static_light_transform = true;
+  }
+  return m_static_lightmap_canvas;
+}
+
 Canvas&
 DrawingContext::get_canvas(DrawingTarget target)
 {
@@ -44,6 +44,10 @@ public:
   DrawingContext(VideoSystem& video_system, obstack& obst, bool overlay, float time_offset);
   ~DrawingContext();
 
+  /** Clears the context and brings it back into the state after
+      construction, so that it can be used for another frame. */
+  void reset(bool overlay, float time_offset);
+
   /** Returns the visible area in world coordinates */
   Rectf get_cliprect() const;
 
@@ -51,6 +55,21 @@ public:
   inline Canvas& light() { assert(!m_overlay); return m_lightmap_canvas; }
   Canvas& get_canvas(DrawingTarget target);
 
+  /** Canvas for lights that stay the same over many frames, like
+      lights that don't move. They are kept in a cached texture by the
+      Compositor and only drawn again when they change, so they have to
+      use Blend::ADD. */
+  Canvas& static_light();
+
+  /** Access to the static lights for the Compositor, without
+      touching get_static_light_transform(). */
+  inline Canvas& get_static_light_canvas() { return m_static_lightmap_canvas; }
+
+  /** The transform that was active when static_light() was first used
+      in this frame. The static lights are kept relative to it and are
+      drawn with it. */
+  inline const DrawingTransform& get_static_light_transform() const { return m_static_light_transform; }
+
   inline void set_ambient_color(Color ambient_color) { m_ambient_color = ambient_color; }
   inline Color get_ambient_color() const { return m_ambient_color; }
 
@@ -128,6 +147,9 @@ private:
 
   Canvas m_colormap_canvas;
   Canvas m_lightmap_canvas;
+  Canvas m_static_lightmap_canvas;
+  DrawingTransform m_static_light_transform;
+  bool m_has_static_light_transform;
 
   float m_time_offset;
 
@@ -0,0 +1,121 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "video/drawing_request.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "util/obstackpp.hpp"
+
+namespace {
+
+template<typename T>
+Span<T> copy_to_obstack(obstack& obst, const T* data, size_t count)
+{
+  return Span<T>(obstack_copy_array(obst, data, count), count);
+}
+
+} // namespace
+
+void
+set_texture_geometry(TextureRequest& request, obstack& obst,
+                     Span<const Rectf> srcrects,
+                     Span<const Rectf> dstrects,
+                     Span<const float> angles)
+{
+  request.srcrects = copy_to_obstack(obst, srcrects.data(), srcrects.size());
+  request.dstrects = copy_to_obstack(obst, dstrects.data(), dstrects.size());
+  if (angles.empty())
+  {
+    request.angles = Span<float>(obstack_alloc_array<float>(obst, srcrects.size()), srcrects.size());
+    std::uninitialized_fill(request.angles.begin(), request.angles.end(), 0.0f);
+  }
+  else
+  {
+    request.angles = copy_to_obstack(obst, angles.data(), angles.size());
+  }
+}
+
+bool
+can_merge(const DrawingRequest& lhs, const DrawingRequest& rhs)
+{
+  if (lhs.layer != rhs.layer || lhs.flip != rhs.flip || lhs.alpha != rhs.alpha ||
+      lhs.blend != rhs.blend || !(lhs.viewport == rhs.viewport))
+    return false;
+
+  const auto* lhs_texture = std::get_if<TextureRequest>(&lhs.request);
+  const auto* rhs_texture = std::get_if<TextureRequest>(&rhs.request);
+  return lhs_texture && rhs_texture &&
+         lhs_texture->texture == rhs_texture->texture &&
+         lhs_texture->displacement_texture == rhs_texture->displacement_texture &&
+         lhs_texture->color == rhs_texture->color;
+}
+
+int
+merge_drawing_requests(std::vector<DrawingRequest*>& requests, obstack& obst)
+{
+  int merged = 0;
+  size_t count = 0;
+  size_t first = 0;
+  while (first < requests.size())
+  {
+    size_t end = first + 1;
+    size_t total = std::holds_alternative<TextureRequest>(requests[first]->request) ?
+      std::get<TextureRequest>(requests[first]->request).srcrects.size() : 0;
+    while (end < requests.size() && can_merge(*requests[first], *requests[end]))
+    {
+      total += std::get<TextureRequest>(requests[end]->request).srcrects.size();
+      end += 1;
+    }
+
+    if (end - first > 1)
+    {
+      // The arrays of the run are allocated once, the old ones stay
+      // on the obstack until the end of the frame.
+      Rectf* srcrects = obstack_alloc_array<Rectf>(obst, total);
+      Rectf* dstrects = obstack_alloc_array<Rectf>(obst, total);
+      float* angles = obstack_alloc_array<float>(obst, total);
+
+      size_t offset = 0;
+      for (size_t i = first; i < end; ++i)
+      {
+        const auto& src = std::get<TextureRequest>(requests[i]->request);
+        std::uninitialized_copy(src.srcrects.begin(), src.srcrects.end(), srcrects + offset);
+        std::uninitialized_copy(src.dstrects.begin(), src.dstrects.end(), dstrects + offset);
+        std::uninitialized_copy(src.angles.begin(), src.angles.end(), angles + offset);
+        offset += src.srcrects.size();
+
+        if (i != first)
+        {
+          requests[i]->~DrawingRequest();
+          merged += 1;
+        }
+      }
+
+      auto& dst = std::get<TextureRequest>(requests[first]->request);
+      dst.srcrects = Span<Rectf>(srcrects, total);
+      dst.dstrects = Span<Rectf>(dstrects, total);
+      dst.angles = Span<float>(angles, total);
+    }
+
+    requests[count++] = requests[first];
+    first = end;
+  }
+  requests.resize(count);
+  return merged;
+}
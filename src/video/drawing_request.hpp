@@ -18,11 +18,14 @@
 
 #include <string>
 #include <memory>
+#include <obstack.h>
 #include <variant>
+#include <vector>
 
 #include "math/rectf.hpp"
 #include "math/sizef.hpp"
 #include "math/vector.hpp"
+#include "util/span.hpp"
 #include "video/blend.hpp"
 #include "video/color.hpp"
 #include "video/drawing_transform.hpp"
@@ -35,9 +38,11 @@ struct TextureRequest
 {
   const Texture* texture;
   const Texture* displacement_texture;
-  std::vector<Rectf> srcrects;
-  std::vector<Rectf> dstrects;
-  std::vector<float> angles;
+  /** The arrays live on the obstack of the Compositor, like the
+      request itself. */
+  Span<Rectf> srcrects;
+  Span<Rectf> dstrects;
+  Span<float> angles;
   Color color;
 };
 
@@ -114,3 +119,19 @@ struct DrawingRequest
   ~DrawingRequest() {}
 
 };
+
+/** Sets the arrays of request to copies of srcrects, dstrects and
+    angles on obst. Without angles all of them are 0. */
+void set_texture_geometry(TextureRequest& request, obstack& obst,
+                          Span<const Rectf> srcrects,
+                          Span<const Rectf> dstrects,
+                          Span<const float> angles);
+
+/** Returns true if rhs can be drawn in the same call as lhs. */
+bool can_merge(const DrawingRequest& lhs, const DrawingRequest& rhs);
+
+/** Merges consecutive texture requests that can be drawn together
+    into the first request of their run, the others are destroyed and
+    removed from requests. The arrays of a merged run are allocated on
+    obst. Returns the number of removed requests. */
+int merge_drawing_requests(std::vector<DrawingRequest*>& requests, obstack& obst);
@@ -31,9 +31,14 @@ public:
   int max_layer;
 
   DrawingTransform(const Viewport& viewport_) :
+    DrawingTransform(Rect(0, 0, viewport_.get_screen_width(), viewport_.get_screen_height()))
+  {}
+
+  /** viewport is the area of the screen that is drawn to, in logical
+      pixels. */
+  explicit DrawingTransform(const Rect& viewport_) :
     translation(0.0f, 0.0f),
-    viewport(0, 0,
-             viewport_.get_screen_width(), viewport_.get_screen_height()),
+    viewport(viewport_),
     flip(NO_FLIP),
     alpha(1.0f),
     scale(1.0f),
@@ -17,6 +17,55 @@
 
 #include "video/font.hpp"
 
+#include "video/render_stats.hpp"
+
+namespace {
+
+/** Amount of texts whose widths and wraps are kept per font, enough
+    for the lines of a large menu or a scrolling text */
+const size_t LAYOUT_CACHE_SIZE = 512;
+
+} // namespace
+
+Font::Font() :
+  m_width_cache(LAYOUT_CACHE_SIZE),
+  m_wrap_cache(LAYOUT_CACHE_SIZE)
+{
+}
+
+float
+Font::get_text_width(const std::string& text) const
+{
+  RenderStats& stats = RenderStats::current();
+  if (const float* width = m_width_cache.get(text))
+  {
+    stats.text_layout_hits += 1;
+    return *width;
+  }
+
+  stats.text_layout_misses += 1;
+  return m_width_cache.put(text, measure_text_width(text));
+}
+
+std::string
+Font::wrap_to_width(const std::string& text, float width, std::string* overflow)
+{
+  RenderStats& stats = RenderStats::current();
+  const WrapKey key{ text, width };
+  if (const Wrap* wrap = m_wrap_cache.get(key))
+  {
+    stats.text_layout_hits += 1;
+    if (overflow) *overflow = wrap->overflow;
+    return wrap->text;
+  }
+
+  stats.text_layout_misses += 1;
+  Wrap wrap;
+  wrap.text = wrap_text_to_width(text, width, &wrap.overflow);
+  if (overflow) *overflow = wrap.overflow;
+  return m_wrap_cache.put(key, std::move(wrap)).text;
+}
+
 std::string
 Font::wrap_to_chars(const std::string& s, int line_length, std::string* overflow)
 {
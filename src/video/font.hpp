@@ -20,6 +20,7 @@
 #include <string>
 
 #include "math/rectf.hpp"
+#include "util/lru_cache.hpp"
 #include "math/vector.hpp"
 #include "video/color.hpp"
 #include "video/surface_ptr.hpp"
@@ -42,15 +43,55 @@ public:
   static std::string wrap_to_chars(const std::string& text, int max_chars, std::string* overflow);
 
 public:
+  Font();
   virtual ~Font() {}
 
   virtual float get_height() const = 0;
 
-  virtual float get_text_width(const std::string& text) const = 0;
+  /** Returns the width of the widest line of text. The widths of
+      recently measured texts are cached. */
+  float get_text_width(const std::string& text) const;
   virtual float get_text_height(const std::string& text) const = 0;
 
-  virtual std::string wrap_to_width(const std::string& text, float width, std::string* overflow) = 0;
+  /** Returns text, truncated (preferably at whitespace) to be at most
+      width pixels wide, the rest goes to overflow. Recent results are
+      cached. */
+  std::string wrap_to_width(const std::string& text, float width, std::string* overflow);
 
   virtual Rectf draw_text(Canvas& canvas, const std::string& text,
                           const Vector& pos, FontAlignment alignment, int layer, const Color& color) = 0;
+
+protected:
+  /** get_text_width() without the cache */
+  virtual float measure_text_width(const std::string& text) const = 0;
+
+  /** wrap_to_width() without the cache */
+  virtual std::string wrap_text_to_width(const std::string& text, float width, std::string* overflow) = 0;
+
+private:
+  struct WrapKey
+  {
+    std::string text;
+    float width;
+
+    bool operator==(const WrapKey& other) const { return width == other.width && text == other.text; }
+  };
+
+  struct WrapKeyHash
+  {
+    size_t operator()(const WrapKey& key) const
+    {
+      return std::hash<std::string>()(key.text) ^ (std::hash<float>()(key.width) * 31);
+    }
+  };
+
+  struct Wrap
+  {
+    std::string text;
+    std::string overflow;
+  };
+
+private:
+  mutable LRUCache<std::string, float> m_width_cache;
+  LRUCache<WrapKey, Wrap, WrapKeyHash> m_wrap_cache;
 };
@@ -16,14 +16,18 @@
 
 #include "video/gl/gl20_context.hpp"
 
+#include <assert.h>
+
 #include "supertux/globals.hpp"
 #include "video/glutil.hpp"
 #include "video/color.hpp"
 #include "video/gl/gl_texture.hpp"
+#include "video/render_stats.hpp"
 
 #ifndef USE_OPENGLES2
 
-GL20Context::GL20Context()
+GL20Context::GL20Context() :
+  m_quad_indices(make_quad_indices())
 {
   assert_gl();
 }
@@ -143,6 +147,8 @@ GL20Context::bind_texture(const Texture& texture, const Texture* displacement_te
 {
   assert_gl();
 
+  RenderStats::current().texture_binds += 1;
+
   glEnable(GL_TEXTURE_2D);
   glBindTexture(GL_TEXTURE_2D, static_cast<const GLTexture&>(texture).get_handle());
 
@@ -176,6 +182,8 @@ GL20Context::bind_no_texture()
 {
   assert_gl();
 
+  RenderStats::current().texture_binds += 1;
+
   glDisable(GL_TEXTURE_2D);
 
   assert_gl();
@@ -187,6 +195,19 @@ GL20Context::draw_arrays(GLenum type, GLint first, GLsizei count)
   assert_gl();
 
   glDrawArrays(type, first, count);
+  RenderStats::current().add_draw_call(count);
+
+  assert_gl();
+}
+
+void
+GL20Context::draw_quads(size_t count)
+{
+  assert_gl();
+  assert(count <= MAX_QUADS);
+
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count * 6), GL_UNSIGNED_SHORT, m_quad_indices.data());
+  RenderStats::current().add_draw_call(static_cast<int>(count * 4));
 
   assert_gl();
 }
@@ -48,9 +48,15 @@ public:
   virtual void bind_no_texture() override;
 
   virtual void draw_arrays(GLenum type, GLint first, GLsizei count) override;
+  virtual void draw_quads(size_t count) override;
 
   virtual bool supports_framebuffer() const override { return false; }
 
+  virtual void end_frame() override {}
+
+private:
+  std::vector<GLushort> m_quad_indices;
+
 private:
   GL20Context(const GL20Context&) = delete;
   GL20Context& operator=(const GL20Context&) = delete;
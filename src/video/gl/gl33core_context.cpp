@@ -16,6 +16,8 @@
 
 #include "video/gl/gl33core_context.hpp"
 
+#include <assert.h>
+
 #include "supertux/globals.hpp"
 #include "video/color.hpp"
 #include "video/gl.hpp"
@@ -25,6 +27,7 @@
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
+#include "video/render_stats.hpp"
 #include <iostream>
 
 GL33CoreContext::GL33CoreContext(GLVideoSystem& video_system) :
@@ -64,6 +67,7 @@ GL33CoreContext::bind()
 
   m_program->bind();
   m_vertex_arrays->bind();
+  RenderStats::current().program_binds += 1;
 
   GLTextureRenderer* back_renderer = static_cast<GLTextureRenderer*>(m_video_system.get_back_renderer());
 
@@ -177,6 +181,12 @@ GL33CoreContext::set_color(const Color& color)
   m_vertex_arrays->set_color(color);
 }
 
+void
+GL33CoreContext::end_frame()
+{
+  m_vertex_arrays->next_frame();
+}
+
 void
 GL33CoreContext::set_blur(int amount)
 {
@@ -188,6 +198,8 @@ GL33CoreContext::bind_texture(const Texture& texture, const Texture* displacemen
 {
   assert_gl();
 
+  RenderStats::current().texture_binds += 1;
+
   GLTextureRenderer* back_renderer = static_cast<GLTextureRenderer*>(m_video_system.get_back_renderer());
   
   /* if there's no back renderer (i.e. fancy fx disabled) then don't
@@ -244,6 +256,8 @@ GL33CoreContext::bind_no_texture()
 {
   assert_gl();
 
+  RenderStats::current().texture_binds += 1;
+
   glUniform1i(m_program->get_blur_location(), m_blur);
   glActiveTexture(GL_TEXTURE0);
   glBindTexture(GL_TEXTURE_2D, m_white_texture->get_handle());
@@ -259,7 +273,23 @@ GL33CoreContext::draw_arrays(GLenum type, GLint first, GLsizei count)
 {
   assert_gl();
 
+  m_vertex_arrays->flush();
   glDrawArrays(type, first, count);
+  RenderStats::current().add_draw_call(count);
+
+  assert_gl();
+}
+
+void
+GL33CoreContext::draw_quads(size_t count)
+{
+  assert_gl();
+  assert(count <= MAX_QUADS);
+
+  // The index buffer is bound by GLVertexArrays.
+  m_vertex_arrays->flush();
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count * 6), GL_UNSIGNED_SHORT, nullptr);
+  RenderStats::current().add_draw_call(static_cast<int>(count * 4));
 
   assert_gl();
 }
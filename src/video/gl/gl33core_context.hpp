@@ -52,9 +52,12 @@ public:
   virtual void bind_texture(const Texture& texture, const Texture* displacement_texture) override;
   virtual void bind_no_texture() override;
   virtual void draw_arrays(GLenum type, GLint first, GLsizei count) override;
+  virtual void draw_quads(size_t count) override;
 
   virtual bool supports_framebuffer() const override { return true; }
 
+  virtual void end_frame() override;
+
   inline GLProgram& get_program() const { return *m_program; }
   inline GLVertexArrays& get_vertex_arrays() const { return *m_vertex_arrays; }
   inline GLTexture& get_white_texture() const { return *m_white_texture; }
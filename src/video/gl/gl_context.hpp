@@ -18,6 +18,7 @@
 
 #include <stddef.h>
 #include <string>
+#include <vector>
 
 #include "video/gl.hpp"
 
@@ -27,6 +28,26 @@ class Texture;
 
 class GLContext
 {
+public:
+  /** Most quads that draw_quads() draws at once, the indices have 16
+      bits as GLES2 has no larger ones. */
+  static constexpr size_t MAX_QUADS = 65536 / 4;
+
+  /** Returns the indices used by draw_quads(), two triangles for
+      every four vertices. */
+  static std::vector<GLushort> make_quad_indices()
+  {
+    std::vector<GLushort> indices;
+    indices.reserve(MAX_QUADS * 6);
+    for (size_t i = 0; i < MAX_QUADS * 4; i += 4)
+    {
+      const GLushort quad[] = { 0, 1, 2, 3, 0, 2 };
+      for (GLushort index : quad)
+        indices.push_back(static_cast<GLushort>(i + index));
+    }
+    return indices;
+  }
+
 public:
   GLContext() {}
   virtual ~GLContext() {}
@@ -54,8 +75,16 @@ public:
 
   virtual void draw_arrays(GLenum type, GLint first, GLsizei count) = 0;
 
+  /** Draws count quads, each from four vertices in the order top left,
+      top right, bottom right, bottom left. count must not be larger
+      than MAX_QUADS. */
+  virtual void draw_quads(size_t count) = 0;
+
   virtual bool supports_framebuffer() const = 0;
 
+  /** Called after a frame was presented */
+  virtual void end_frame() = 0;
+
 private:
   GLContext(const GLContext&) = delete;
   GLContext& operator=(const GLContext&) = delete;
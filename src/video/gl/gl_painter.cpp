@@ -23,13 +23,13 @@
 #include "supertux/globals.hpp"
 #include "video/drawing_request.hpp"
 #include "video/gl/gl_context.hpp"
-#include "video/gl/gl_pixel_request.hpp"
 #include "video/gl/gl_program.hpp"
 #include "video/gl/gl_renderer.hpp"
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
+#include "video/render_stats.hpp"
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
 
@@ -63,7 +63,8 @@ GLPainter::GLPainter(GLVideoSystem& video_system, GLRenderer& renderer) :
   m_video_system(video_system),
   m_renderer(renderer),
   m_vertices(),
-  m_uvs()
+  m_uvs(),
+  m_pixel_readback()
 {
 }
 
@@ -78,23 +79,30 @@ GLPainter::draw_texture(const DrawingRequest& draw_req)
   assert(request.srcrects.size() == request.dstrects.size());
   assert(request.srcrects.size() == request.angles.size());
 
-  m_vertices.reserve(request.srcrects.size() * 12);
-  m_uvs.reserve(request.srcrects.size() * 12);
+  const size_t count = request.srcrects.size();
+  m_vertices.resize(count * 8);
+  m_uvs.resize(count * 8);
 
-  m_vertices.clear();
-  m_uvs.clear();
+  const float texture_width = static_cast<float>(texture.get_texture_width());
+  const float texture_height = static_cast<float>(texture.get_texture_height());
 
-  for (size_t i = 0; i < request.srcrects.size(); ++i)
+  // Every quad is four vertices, top left, top right, bottom right and
+  // bottom left, see GLContext::draw_quads().
+  float* vertices = m_vertices.data();
+  float* uvs = m_uvs.data();
+  float covered_pixels = 0.0f;
+  for (size_t i = 0; i < count; ++i, vertices += 8, uvs += 8)
   {
     const float left = request.dstrects[i].get_left();
     const float top = request.dstrects[i].get_top();
     const float right  = request.dstrects[i].get_right();
     const float bottom = request.dstrects[i].get_bottom();
+    covered_pixels += (right - left) * (bottom - top);
 
-    float uv_left = request.srcrects[i].get_left() / static_cast<float>(texture.get_texture_width());
-    float uv_top = request.srcrects[i].get_top() / static_cast<float>(texture.get_texture_height());
-    float uv_right = request.srcrects[i].get_right() / static_cast<float>(texture.get_texture_width());
-    float uv_bottom = request.srcrects[i].get_bottom() / static_cast<float>(texture.get_texture_height());
+    float uv_left = request.srcrects[i].get_left() / texture_width;
+    float uv_top = request.srcrects[i].get_top() / texture_height;
+    float uv_right = request.srcrects[i].get_right() / texture_width;
+    float uv_bottom = request.srcrects[i].get_bottom() / texture_height;
 
     if (draw_req.flip & HORIZONTAL_FLIP)
       std::swap(uv_left, uv_right);
@@ -104,27 +112,10 @@ GLPainter::draw_texture(const DrawingRequest& draw_req)
 
     if (request.angles[i] == 0.0f)
     {
-      const float vertices_lst[] = {
-        left, top,
-        right, top,
-        right, bottom,
-
-        left, bottom,
-        left, top,
-        right, bottom,
-      };
-      m_vertices.insert(m_vertices.end(), vertices_lst, vertices_lst + 12);
-
-      const float uvs_lst[] = {
-        uv_left, uv_top,
-        uv_right, uv_top,
-        uv_right, uv_bottom,
-
-        uv_left, uv_bottom,
-        uv_left, uv_top,
-        uv_right, uv_bottom,
-      };
-      m_uvs.insert(m_uvs.end(), uvs_lst, uvs_lst + 12);
+      vertices[0] = left;  vertices[1] = top;
+      vertices[2] = right; vertices[3] = top;
+      vertices[4] = right; vertices[5] = bottom;
+      vertices[6] = left;  vertices[7] = bottom;
     }
     else
     {
@@ -141,42 +132,36 @@ GLPainter::draw_texture(const DrawingRequest& draw_req)
       const float new_top = top - center_y;
       const float new_bottom = bottom - center_y;
 
-      const float vertices_lst[] = {
-        new_left*ca - new_top*sa + center_x, new_left*sa + new_top*ca + center_y,
-        new_right*ca - new_top*sa + center_x, new_right*sa + new_top*ca + center_y,
-        new_right*ca - new_bottom*sa + center_x, new_right*sa + new_bottom*ca + center_y,
-
-        new_left*ca - new_bottom*sa + center_x, new_left*sa + new_bottom*ca + center_y,
-        new_left*ca - new_top*sa + center_x, new_left*sa + new_top*ca + center_y,
-        new_right*ca - new_bottom*sa + center_x, new_right*sa + new_bottom*ca + center_y,
-      };
-      m_vertices.insert(m_vertices.end(), vertices_lst, vertices_lst + 12);
-
-      const float uvs_lst[] = {
-        uv_left, uv_top,
-        uv_right, uv_top,
-        uv_right, uv_bottom,
-
-        uv_left, uv_bottom,
-        uv_left, uv_top,
-        uv_right, uv_bottom,
-      };
-      m_uvs.insert(m_uvs.end(), uvs_lst, uvs_lst + 12);
+      vertices[0] = new_left*ca - new_top*sa + center_x;     vertices[1] = new_left*sa + new_top*ca + center_y;
+      vertices[2] = new_right*ca - new_top*sa + center_x;    vertices[3] = new_right*sa + new_top*ca + center_y;
+      vertices[4] = new_right*ca - new_bottom*sa + center_x; vertices[5] = new_right*sa + new_bottom*ca + center_y;
+      vertices[6] = new_left*ca - new_bottom*sa + center_x;  vertices[7] = new_left*sa + new_bottom*ca + center_y;
     }
+
+    uvs[0] = uv_left;  uvs[1] = uv_top;
+    uvs[2] = uv_right; uvs[3] = uv_top;
+    uvs[4] = uv_right; uvs[5] = uv_bottom;
+    uvs[6] = uv_left;  uvs[7] = uv_bottom;
   }
 
+  RenderStats::current().covered_pixels += covered_pixels;
+
   GLContext& context = m_video_system.get_context();
 
   context.blend_func(sfactor(draw_req.blend), dfactor(draw_req.blend));
   context.bind_texture(texture, request.displacement_texture);
-  context.set_texcoords(m_uvs.data(), sizeof(float) * m_uvs.size());
-  context.set_positions(m_vertices.data(), sizeof(float) * m_vertices.size());
   context.set_color(Color(request.color.red,
                           request.color.green,
                           request.color.blue,
                           request.color.alpha * draw_req.alpha));
 
-  context.draw_arrays(GL_TRIANGLES, 0, static_cast<GLsizei>(request.srcrects.size() * 2 * 3));
+  for (size_t first = 0; first < count; first += GLContext::MAX_QUADS)
+  {
+    const size_t quads = std::min(count - first, GLContext::MAX_QUADS);
+    context.set_texcoords(m_uvs.data() + first * 8, sizeof(float) * quads * 8);
+    context.set_positions(m_vertices.data() + first * 8, sizeof(float) * quads * 8);
+    context.draw_quads(quads);
+  }
 
   assert_gl();
 }
@@ -480,7 +465,7 @@ GLPainter::clear(const Color& color)
 }
 
 void
-GLPainter::get_pixel(const DrawingRequest& draw_req) const
+GLPainter::get_pixel(const DrawingRequest& draw_req)
 {
   auto&& request = std::get<GetPixelRequest>(draw_req.request);
   assert_gl();
@@ -494,29 +479,20 @@ GLPainter::get_pixel(const DrawingRequest& draw_req) const
   x += static_cast<float>(rect.left);
   y += static_cast<float>(rect.top);
 
-#if 0
-  // #ifndef USE_OPENGLES2
-  //
-  // FIXME: glFenceSync() causes crashes on Intel I965, so disable
-  // GLPixelRequest for now, it's not yet properly used anyway.
-  GLPixelRequest pixel_request(1, 1);
-  pixel_request.request(static_cast<int>(x), static_cast<int>(y));
-
-  *(request.color_ptr) = pixel_request.get_color();
-
-#else
-  float pixels[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-
-  // OpenGLES2 does not have PBOs, only GLES3 has.
-  glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y),
-               1, 1, GL_RGB, GL_FLOAT, pixels);
-
-  *(request.color_ptr) = Color(pixels[0], pixels[1], pixels[2]);
-#endif
+  // Reading a single pixel stalls until the GPU has finished the
+  // frame, so all pixels of a frame are read at once in
+  // flush_pixel_requests().
+  m_pixel_readback.add(static_cast<int>(x), static_cast<int>(y), request.color_ptr);
 
   assert_gl();
 }
 
+void
+GLPainter::flush_pixel_requests()
+{
+  m_pixel_readback.flush();
+}
+
 void
 GLPainter::set_clip_rect(const Rect& clip_rect)
 {
@@ -19,6 +19,7 @@
 #include "video/painter.hpp"
 
 #include "video/flip.hpp"
+#include "video/gl/gl_pixel_readback.hpp"
 
 enum class Blend;
 class GLRenderer;
@@ -37,7 +38,8 @@ public:
   virtual void draw_triangle(const DrawingRequest& request) override;
 
   virtual void clear(const Color& color) override;
-  virtual void get_pixel(const DrawingRequest& request) const override;
+  virtual void get_pixel(const DrawingRequest& request) override;
+  virtual void flush_pixel_requests() override;
 
   virtual void set_clip_rect(const Rect& rect) override;
   virtual void clear_clip_rect() override;
@@ -49,6 +51,7 @@ private:
 private:
   std::vector<float> m_vertices;
   std::vector<float> m_uvs;
+  GLPixelReadback m_pixel_readback;
 
 private:
   GLPainter(const GLPainter&) = delete;
@@ -0,0 +1,117 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/gl/gl_pixel_readback.hpp"
+
+#include <algorithm>
+
+#include "video/gl/gl_pixel_request.hpp"
+#include "video/glutil.hpp"
+
+GLPixelReadback::GLPixelReadback() :
+  m_requests(),
+#ifndef USE_OPENGLES2
+  m_slots(LATENCY + 1),
+#endif
+  m_data(),
+  m_frame(0)
+{
+}
+
+GLPixelReadback::~GLPixelReadback()
+{
+}
+
+void
+GLPixelReadback::add(int x, int y, const std::shared_ptr<Color>& color)
+{
+  m_requests.push_back({ x, y, color });
+}
+
+void
+GLPixelReadback::flush()
+{
+  m_frame += 1;
+
+#ifndef USE_OPENGLES2
+  for (auto& slot : m_slots)
+  {
+    if (!slot.requests.empty() && m_frame - slot.frame >= LATENCY)
+    {
+      slot.pixels->get(m_data);
+      deliver(slot.pixels->get_rect(), slot.requests);
+      slot.requests.clear();
+    }
+  }
+
+  if (m_requests.empty())
+    return;
+
+  // With LATENCY + 1 slots the slot of this frame has been delivered
+  // above, reading into it doesn't overwrite pending pixels.
+  auto& slot = m_slots[static_cast<size_t>(m_frame) % m_slots.size()];
+  if (!slot.pixels)
+    slot.pixels = std::make_unique<GLPixelRequest>();
+
+  slot.pixels->request(get_bounds(m_requests));
+  slot.requests.swap(m_requests);
+  slot.frame = m_frame;
+  m_requests.clear();
+#else
+  if (m_requests.empty())
+    return;
+
+  // OpenGL ES 2 has no pixel buffer objects, read synchronously.
+  assert_gl();
+
+  const Rect rect = get_bounds(m_requests);
+  m_data.resize(static_cast<size_t>(rect.get_width() * rect.get_height() * 4));
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels(rect.left, rect.top, rect.get_width(), rect.get_height(),
+               GL_RGBA, GL_UNSIGNED_BYTE, m_data.data());
+
+  assert_gl();
+
+  deliver(rect, m_requests);
+  m_requests.clear();
+#endif
+}
+
+Rect
+GLPixelReadback::get_bounds(const std::vector<Request>& requests) const
+{
+  Rect rect(requests.front().x, requests.front().y,
+            requests.front().x + 1, requests.front().y + 1);
+  for (const auto& request : requests)
+  {
+    rect.left = std::min(rect.left, request.x);
+    rect.top = std::min(rect.top, request.y);
+    rect.right = std::max(rect.right, request.x + 1);
+    rect.bottom = std::max(rect.bottom, request.y + 1);
+  }
+  return rect;
+}
+
+void
+GLPixelReadback::deliver(const Rect& rect, const std::vector<Request>& requests)
+{
+  for (const auto& request : requests)
+  {
+    const size_t index = static_cast<size_t>(((request.y - rect.top) * rect.get_width() +
+                                              (request.x - rect.left)) * 4);
+    *request.color = Color::from_rgb888(m_data[index], m_data[index + 1], m_data[index + 2]);
+  }
+}
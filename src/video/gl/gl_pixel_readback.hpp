@@ -0,0 +1,91 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "video/color.hpp"
+#include "video/gl.hpp"
+
+class GLPixelRequest;
+
+/**
+ * Collects the get_pixel() requests of a frame and answers all of them
+ * with a single read of the framebuffer.
+ *
+ * With pixel buffer objects the read is asynchronous and its colors
+ * are delivered LATENCY frames later, so that reading never waits for
+ * the GPU. Without them (OpenGL ES 2) the pixels are read right away,
+ * but still only once per frame.
+ */
+class GLPixelReadback final
+{
+public:
+  /** Frames between reading the pixels and delivering their colors */
+  static const int LATENCY = 2;
+
+public:
+  GLPixelReadback();
+  ~GLPixelReadback();
+
+  /** Queues reading the pixel at x, y of the framebuffer into color. */
+  void add(int x, int y, const std::shared_ptr<Color>& color);
+
+  /** Reads the pixels queued since the last call and delivers the
+      colors of earlier reads that are due. Has to be called while the
+      framebuffer the pixels belong to is bound. */
+  void flush();
+
+private:
+  struct Request
+  {
+    int x;
+    int y;
+    std::shared_ptr<Color> color;
+  };
+
+#ifndef USE_OPENGLES2
+  struct Slot
+  {
+    std::unique_ptr<GLPixelRequest> pixels;
+    std::vector<Request> requests;
+    int frame;
+  };
+
+#endif
+
+  /** Returns the smallest rectangle containing all requests. */
+  Rect get_bounds(const std::vector<Request>& requests) const;
+
+  /** Sets the colors of requests from the pixels of rect in m_data. */
+  void deliver(const Rect& rect, const std::vector<Request>& requests);
+
+private:
+  std::vector<Request> m_requests;
+#ifndef USE_OPENGLES2
+  std::vector<Slot> m_slots;
+#endif
+  std::vector<uint8_t> m_data;
+  int m_frame;
+
+private:
+  GLPixelReadback(const GLPixelReadback&) = delete;
+  GLPixelReadback& operator=(const GLPixelReadback&) = delete;
+};
@@ -16,26 +16,18 @@
 
 #include "video/gl/gl_pixel_request.hpp"
 
-#include <iostream>
-
-#include "util/log.hpp"
 #include "video/glutil.hpp"
 
 #ifndef USE_OPENGLES2
 
-GLPixelRequest::GLPixelRequest(int width, int height) :
+GLPixelRequest::GLPixelRequest() :
   m_buffer(),
-  m_width(width),
-  m_height(height),
-  m_offset(0),
-  m_sync()
+  m_capacity(0),
+  m_rect()
 {
   assert_gl();
 
   glGenBuffers(1, &m_buffer);
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, m_buffer);
-  glBufferData(GL_PIXEL_PACK_BUFFER, m_width * m_height * 4, nullptr, GL_DYNAMIC_READ);
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
   assert_gl();
 }
@@ -46,69 +38,38 @@ GLPixelRequest::~GLPixelRequest()
 }
 
 void
-GLPixelRequest::request(int x, int y)
+GLPixelRequest::request(const Rect& rect)
 {
   assert_gl();
 
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, m_buffer);
-  glReadPixels(x, y, m_width, m_height, GL_RGB, GL_UNSIGNED_BYTE,
-               reinterpret_cast<GLvoid*>(m_offset));
-  m_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, GL_NONE_BIT);
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  m_rect = rect;
+  const size_t size = static_cast<size_t>(m_rect.get_width() * m_rect.get_height() * 4);
 
-  assert_gl();
-}
-
-bool
-GLPixelRequest::is_ready() const
-{
-  assert_gl();
-
-  GLenum ret = glClientWaitSync(m_sync, GL_NONE_BIT, 0);
-
-  if (ret == GL_CONDITION_SATISFIED ||
-      ret == GL_ALREADY_SIGNALED)
-  {
-    //std::cout << "fence ready: " << static_cast<int>(ret) << " " << GL_ALREADY_SIGNALED << std::endl;
-    return true;
-  }
-  else if (ret == GL_TIMEOUT_EXPIRED)
-
-  {
-    //std::cout << "timeout: " << static_cast<int>(ret) << std::endl;
-    return false;
-  }
-  else if (ret == GL_WAIT_FAILED)
-  {
-    return true;
-  }
-  else
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, m_buffer);
+  if (size > m_capacity)
   {
-    log_warning << "unknown glClientWaitSync() return value: " << static_cast<int>(ret) << std::endl;
-    return true;
+    glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+    m_capacity = size;
   }
+  glReadPixels(m_rect.left, m_rect.top, m_rect.get_width(), m_rect.get_height(),
+               GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
   assert_gl();
 }
 
 void
-GLPixelRequest::get(void* buffer, size_t length) const
+GLPixelRequest::get(std::vector<uint8_t>& data) const
 {
   assert_gl();
 
+  data.resize(static_cast<size_t>(m_rect.get_width() * m_rect.get_height() * 4));
+
   glBindBuffer(GL_PIXEL_PACK_BUFFER, m_buffer);
-  glGetBufferSubData(GL_PIXEL_PACK_BUFFER, m_offset, length, buffer);
+  glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(data.size()), data.data());
   glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
   assert_gl();
 }
 
-Color
-GLPixelRequest::get_color() const
-{
-  uint8_t data[3];
-  get(data, sizeof(data));
-  return Color::from_rgb888(data[0], data[1], data[2]);
-}
-
 #endif
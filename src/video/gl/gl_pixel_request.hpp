@@ -17,31 +17,39 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
+#include <vector>
 
-#include "video/color.hpp"
+#include "math/rect.hpp"
 #include "video/gl.hpp"
 
 #ifndef USE_OPENGLES2
 
+/**
+ * Reads a rectangle of the bound framebuffer into a pixel buffer
+ * object. glReadPixels() returns right away, the data is only copied
+ * to the CPU with get(), which blocks if the GPU isn't done with it
+ * yet, so get() should be called a few frames after request().
+ */
 class GLPixelRequest final
 {
 public:
-  GLPixelRequest(int width, int height);
+  GLPixelRequest();
   ~GLPixelRequest();
 
-  void request(int x, int y);
-  bool is_ready() const;
-  Color get_color() const;
+  /** Starts reading rect of the bound framebuffer as RGBA. */
+  void request(const Rect& rect);
 
-private:
-  void get(void* buffer, size_t length) const;
+  /** Copies the pixels of the last request() into data, row by row
+      and four bytes per pixel. */
+  void get(std::vector<uint8_t>& data) const;
+
+  inline const Rect& get_rect() const { return m_rect; }
 
 private:
   GLuint m_buffer;
-  int m_width;
-  int m_height;
-  GLintptr m_offset;
-  GLsync m_sync;
+  size_t m_capacity;
+  Rect m_rect;
 
 private:
   GLPixelRequest(const GLPixelRequest&) = delete;
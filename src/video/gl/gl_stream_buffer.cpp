@@ -0,0 +1,140 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/gl/gl_stream_buffer.hpp"
+
+#include <string.h>
+
+#include "util/log.hpp"
+#include "video/glutil.hpp"
+
+#ifndef USE_OPENGLES2
+
+namespace {
+
+/** Offsets are kept aligned, so that every attribute starts at a
+    properly aligned address. */
+const size_t ALIGNMENT = 16;
+
+/** How long to wait for the GPU to release a region, in nanoseconds */
+const GLuint64 FENCE_TIMEOUT = 1000000000;
+
+} // namespace
+
+GLStreamBuffer::GLStreamBuffer(size_t frame_size, int frames) :
+  m_handle(),
+  m_frame_size(frame_size),
+  m_fences(frames, nullptr),
+  m_frame(0),
+  m_offset(0),
+  m_mapped(nullptr),
+  m_mapped_start(0)
+{
+  assert_gl();
+
+  glGenBuffers(1, &m_handle);
+  glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+  glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_frame_size * m_fences.size()), nullptr, GL_STREAM_DRAW);
+
+  assert_gl();
+}
+
+GLStreamBuffer::~GLStreamBuffer()
+{
+  unmap();
+  for (GLsync fence : m_fences)
+  {
+    if (fence)
+      glDeleteSync(fence);
+  }
+  glDeleteBuffers(1, &m_handle);
+}
+
+bool
+GLStreamBuffer::append(const void* data, size_t size, size_t& offset)
+{
+  assert_gl();
+
+  const size_t start = (m_offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  if (size == 0 || start + size > m_frame_size)
+    return false;
+
+  const size_t frame_start = static_cast<size_t>(m_frame) * m_frame_size;
+  offset = frame_start + start;
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+  if (!m_mapped)
+  {
+    // Map all of the rest of the region, the other attributes of the
+    // draw call follow.
+    m_mapped = static_cast<char*>(glMapBufferRange(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset),
+                                                   static_cast<GLsizeiptr>(m_frame_size - start),
+                                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                                                   GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+    if (!m_mapped)
+      return false;
+    m_mapped_start = start;
+  }
+
+  memcpy(m_mapped + (start - m_mapped_start), data, size);
+  m_offset = start + size;
+
+  assert_gl();
+  return true;
+}
+
+void
+GLStreamBuffer::unmap()
+{
+  if (!m_mapped)
+    return;
+
+  assert_gl();
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+  glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(m_offset - m_mapped_start));
+  if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE)
+    log_warning << "Vertex buffer got corrupted while it was mapped" << std::endl;
+  m_mapped = nullptr;
+
+  assert_gl();
+}
+
+void
+GLStreamBuffer::next_frame()
+{
+  unmap();
+
+  assert_gl();
+
+  m_fences[m_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  m_frame = (m_frame + 1) % static_cast<int>(m_fences.size());
+  m_offset = 0;
+
+  GLsync& fence = m_fences[m_frame];
+  if (fence)
+  {
+    if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT) == GL_TIMEOUT_EXPIRED)
+      log_warning << "Timeout while waiting for the GPU to release a vertex buffer region" << std::endl;
+    glDeleteSync(fence);
+    fence = nullptr;
+  }
+
+  assert_gl();
+}
+
+#endif
@@ -0,0 +1,79 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "video/gl.hpp"
+
+#ifndef USE_OPENGLES2
+
+/**
+ * A vertex buffer that the vertex data of a whole frame is appended
+ * to, instead of reallocating a buffer with glBufferData() for every
+ * draw call.
+ *
+ * The buffer is split into one region per frame in flight. The regions
+ * are used round robin and written unsynchronized, a fence set at the
+ * end of a frame tells when the GPU is done with its region, so that
+ * the region can be overwritten.
+ *
+ * The unused rest of the region is mapped by the first append() after
+ * a draw call, all attributes of the draw call are written to it and
+ * unmap() makes them available to the GPU at once.
+ */
+class GLStreamBuffer final
+{
+public:
+  GLStreamBuffer(size_t frame_size, int frames);
+  ~GLStreamBuffer();
+
+  /** Copies size bytes of data into the region of the current frame
+      and stores their offset in the buffer in offset. Returns false if
+      the region is full, the caller then has to upload the data in
+      another way. The buffer is left bound to GL_ARRAY_BUFFER. */
+  bool append(const void* data, size_t size, size_t& offset);
+
+  /** Unmaps the data appended since the last call, has to be called
+      before the data is drawn. */
+  void unmap();
+
+  /** Marks the end of the frame, the next one will use the next
+      region. */
+  void next_frame();
+
+  inline GLuint get_handle() const { return m_handle; }
+
+private:
+  GLuint m_handle;
+  size_t m_frame_size;
+  std::vector<GLsync> m_fences;
+  int m_frame;
+  size_t m_offset;
+
+  /** Mapped part of the region of the current frame, nullptr if
+      nothing is mapped */
+  char* m_mapped;
+  size_t m_mapped_start;
+
+private:
+  GLStreamBuffer(const GLStreamBuffer&) = delete;
+  GLStreamBuffer& operator=(const GLStreamBuffer&) = delete;
+};
+
+#endif
@@ -197,6 +197,39 @@ GLTexture::reload(const SDL_Surface& image)
   assert_gl();
 }
 
+void
+GLTexture::update(const SDL_Surface& image, int x, int y)
+{
+  assert(x >= 0 && y >= 0 && x + image.w <= m_image_width && y + image.h <= m_image_height);
+
+  SDLSurfacePtr convert = SDLSurface::create_rgba(image.w, image.h);
+  SDL_SetSurfaceBlendMode(const_cast<SDL_Surface*>(&image), SDL_BLENDMODE_NONE);
+  SDL_BlitSurface(const_cast<SDL_Surface*>(&image), nullptr, convert.get(), nullptr);
+
+  assert_gl();
+
+  glBindTexture(GL_TEXTURE_2D, m_handle);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+#if defined(GL_UNPACK_ROW_LENGTH)
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, convert->pitch / 4);
+#else
+  assert(convert->pitch == image.w * 4);
+#endif
+
+  if (SDL_MUSTLOCK(convert)) {
+    SDL_LockSurface(convert.get());
+  }
+
+  glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, image.w, image.h,
+                  GL_RGBA, GL_UNSIGNED_BYTE, convert->pixels);
+
+  if (SDL_MUSTLOCK(convert.get())) {
+    SDL_UnlockSurface(convert.get());
+  }
+
+  assert_gl();
+}
+
 GLTexture::~GLTexture()
 {
   glDeleteTextures(1, &m_handle);
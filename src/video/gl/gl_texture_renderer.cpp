@@ -99,6 +99,8 @@ GLTextureRenderer::end_draw()
 {
   assert_gl();
 
+  m_painter.flush_pixel_requests();
+
   if (m_framebuffer)
   {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
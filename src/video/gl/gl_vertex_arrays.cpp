@@ -19,15 +19,31 @@
 #include "video/color.hpp"
 #include "video/gl/gl33core_context.hpp"
 #include "video/gl/gl_program.hpp"
+#include "video/gl/gl_stream_buffer.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
 
+#ifndef USE_OPENGLES2
+
+namespace {
+
+/** Bytes of vertex data that can be streamed per frame */
+const size_t STREAM_FRAME_SIZE = 2 * 1024 * 1024;
+
+/** Frames that may be in flight on the GPU at the same time */
+const int STREAM_FRAMES = 3;
+
+} // namespace
+
+#endif
+
 GLVertexArrays::GLVertexArrays(GL33CoreContext& context) :
   m_context(context),
   m_vao(),
   m_positions_buffer(),
   m_texcoords_buffer(),
-  m_color_buffer()
+  m_color_buffer(),
+  m_quad_index_buffer()
 {
   assert_gl();
 
@@ -36,14 +52,28 @@ GLVertexArrays::GLVertexArrays(GL33CoreContext& context) :
   glGenBuffers(1, &m_texcoords_buffer);
   glGenBuffers(1, &m_color_buffer);
 
+  const std::vector<GLushort> indices = GLContext::make_quad_indices();
+  glGenBuffers(1, &m_quad_index_buffer);
+  glBindVertexArray(m_vao);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quad_index_buffer);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * indices.size(), indices.data(), GL_STATIC_DRAW);
+
+#ifndef USE_OPENGLES2
+  m_stream_buffer.reset(new GLStreamBuffer(STREAM_FRAME_SIZE, STREAM_FRAMES));
+#endif
+
   assert_gl();
 }
 
 GLVertexArrays::~GLVertexArrays()
 {
+#ifndef USE_OPENGLES2
+  m_stream_buffer.reset();
+#endif
   glDeleteBuffers(1, &m_positions_buffer);
   glDeleteBuffers(1, &m_texcoords_buffer);
   glDeleteBuffers(1, &m_color_buffer);
+  glDeleteBuffers(1, &m_quad_index_buffer);
   glDeleteVertexArrays(1, &m_vao);
 }
 
@@ -53,38 +83,43 @@ GLVertexArrays::bind()
   assert_gl();
 
   glBindVertexArray(m_vao);
+  // Part of the vertex array object, but GLES2 has none.
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quad_index_buffer);
 
   assert_gl();
 }
 
 void
-GLVertexArrays::set_positions(const float* data, size_t size)
+GLVertexArrays::set_attribute(GLuint buffer, int loc, int components, const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_positions_buffer);
-  glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
-
-  int loc = m_context.get_program().get_position_location();
-  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+  size_t offset = 0;
+#ifndef USE_OPENGLES2
+  if (!m_stream_buffer->append(data, size, offset))
+#endif
+  {
+    offset = 0;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+  }
+
+  glVertexAttribPointer(loc, components, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<const void*>(offset));
   glEnableVertexAttribArray(loc);
 
   assert_gl();
 }
 
 void
-GLVertexArrays::set_texcoords(const float* data, size_t size)
+GLVertexArrays::set_positions(const float* data, size_t size)
 {
-  assert_gl();
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_texcoords_buffer);
-  glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
-
-  int loc = m_context.get_program().get_texcoord_location();
-  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
-  glEnableVertexAttribArray(loc);
+  set_attribute(m_positions_buffer, m_context.get_program().get_position_location(), 2, data, size);
+}
 
-  assert_gl();
+void
+GLVertexArrays::set_texcoords(const float* data, size_t size)
+{
+  set_attribute(m_texcoords_buffer, m_context.get_program().get_texcoord_location(), 2, data, size);
 }
 
 void
@@ -102,16 +137,7 @@ GLVertexArrays::set_texcoord(float u, float v)
 void
 GLVertexArrays::set_colors(const float* data, size_t size)
 {
-  assert_gl();
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_color_buffer);
-  glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
-
-  int loc = m_context.get_program().get_diffuse_location();
-  glVertexAttribPointer(loc, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
-  glEnableVertexAttribArray(loc);
-
-  assert_gl();
+  set_attribute(m_color_buffer, m_context.get_program().get_diffuse_location(), 4, data, size);
 }
 
 void
@@ -125,3 +151,19 @@ GLVertexArrays::set_color(const Color& color)
 
   assert_gl();
 }
+
+void
+GLVertexArrays::flush()
+{
+#ifndef USE_OPENGLES2
+  m_stream_buffer->unmap();
+#endif
+}
+
+void
+GLVertexArrays::next_frame()
+{
+#ifndef USE_OPENGLES2
+  m_stream_buffer->next_frame();
+#endif
+}
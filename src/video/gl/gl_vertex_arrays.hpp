@@ -17,11 +17,13 @@
 #pragma once
 
 #include <stddef.h>
+#include <memory>
 
 #include "video/gl.hpp"
 
 class Color;
 class GL33CoreContext;
+class GLStreamBuffer;
 
 class GLVertexArrays final
 {
@@ -40,13 +42,32 @@ public:
   void set_colors(const float* data, size_t size);
   void set_color(const Color& color);
 
+  /** Called before every draw call, makes the data given to the
+      set_*() functions available to it. */
+  void flush();
+
+  /** Called at the end of every frame, see GLStreamBuffer */
+  void next_frame();
+
+private:
+  void set_attribute(GLuint buffer, int loc, int components, const float* data, size_t size);
+
 private:
   GL33CoreContext& m_context;
   GLuint m_vao;
+
+  /** Only used when the data doesn't fit into m_stream_buffer */
   GLuint m_positions_buffer;
   GLuint m_texcoords_buffer;
   GLuint m_color_buffer;
 
+  /** Static indices for GLContext::draw_quads() */
+  GLuint m_quad_index_buffer;
+
+#ifndef USE_OPENGLES2
+  std::unique_ptr<GLStreamBuffer> m_stream_buffer;
+#endif
+
 private:
   GLVertexArrays(const GLVertexArrays&) = delete;
   GLVertexArrays& operator=(const GLVertexArrays&) = delete;
@@ -78,6 +78,7 @@ GLVideoSystem::GLVideoSystem(bool use_opengl33core, bool auto_opengl_version) :
   m_texture_manager(),
   m_renderer(),
   m_lightmap(),
+  m_static_lightmap(),
   m_back_renderer(),
   m_context(),
   m_glcontext(),
@@ -142,6 +143,7 @@ GLVideoSystem::~GLVideoSystem()
   m_texture_manager.reset();
   m_renderer.reset();
   m_lightmap.reset();
+  m_static_lightmap.reset();
   m_back_renderer.reset();
   m_context.reset();
   SDL_GL_DestroyContext(m_glcontext);
@@ -325,6 +327,7 @@ GLVideoSystem::apply_config()
   }
 
   m_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 5));
+  m_static_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size() * 2, 5));
   if (m_use_opengl33core && g_config->fancy_gfx)
   {
     m_back_renderer.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 1));
@@ -343,6 +346,12 @@ GLVideoSystem::get_lightmap() const
   return *m_lightmap;
 }
 
+Renderer&
+GLVideoSystem::get_static_lightmap() const
+{
+  return *m_static_lightmap;
+}
+
 Renderer*
 GLVideoSystem::get_back_renderer() const
 {
@@ -360,6 +369,7 @@ GLVideoSystem::flip()
 {
   assert_gl();
   SDL_GL_SwapWindow(m_sdl_window.get());
+  m_context->end_frame();
 
 #ifdef WIN32
   if (WORST_FUCKING_HACK_IN_THIS_CODEBASE)
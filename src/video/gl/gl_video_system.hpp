@@ -46,6 +46,7 @@ public:
   virtual Renderer* get_back_renderer() const override;
   virtual Renderer& get_renderer() const override;
   virtual Renderer& get_lightmap() const override;
+  virtual Renderer& get_static_lightmap() const override;
 
   virtual TexturePtr new_texture(const SDL_Surface& image, const Sampler& sampler) override;
 
@@ -69,6 +70,7 @@ private:
   std::unique_ptr<TextureManager> m_texture_manager;
   std::unique_ptr<GLScreenRenderer> m_renderer;
   std::unique_ptr<GLTextureRenderer> m_lightmap;
+  std::unique_ptr<GLTextureRenderer> m_static_lightmap;
   std::unique_ptr<GLTextureRenderer> m_back_renderer;
   std::unique_ptr<GLContext> m_context;
 
@@ -0,0 +1,115 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * A list of items that are walked in the order of their layers,
+ * without sorting them: every layer has its own bucket, the buckets
+ * are kept in the order of their layers and items are appended to
+ * them. Items of the same layer keep the order in which they were
+ * added, like with std::stable_sort().
+ *
+ * Mostly the same layers are used every frame, so the buckets and
+ * their memory are kept over clear().
+ */
+template<typename T>
+class LayerBuckets final
+{
+public:
+  struct Bucket
+  {
+    int layer;
+    std::vector<T> items;
+  };
+
+public:
+  LayerBuckets() :
+    m_buckets(),
+    m_last(0)
+  {}
+
+  void push_back(int layer, const T& item)
+  {
+    // Items mostly come in runs of the same layer.
+    if (m_last >= m_buckets.size() || m_buckets[m_last].layer != layer)
+      m_last = get_bucket(layer);
+
+    m_buckets[m_last].items.push_back(item);
+  }
+
+  /** Returns the buckets in the order of their layers, some of them
+      may be empty. The items may be changed, but not their layers. */
+  inline std::vector<Bucket>& get_buckets() { return m_buckets; }
+  inline const std::vector<Bucket>& get_buckets() const { return m_buckets; }
+
+  /** Calls func with every item, in the order of their layers. */
+  template<typename F>
+  void for_each(F func) const
+  {
+    for (const auto& bucket : m_buckets)
+      for (const auto& item : bucket.items)
+        func(item);
+  }
+
+  size_t size() const
+  {
+    size_t result = 0;
+    for (const auto& bucket : m_buckets)
+      result += bucket.items.size();
+    return result;
+  }
+
+  bool empty() const
+  {
+    return std::all_of(m_buckets.begin(), m_buckets.end(),
+                       [](const Bucket& bucket) { return bucket.items.empty(); });
+  }
+
+  /** Removes all items. Buckets that weren't used since the last
+      clear() are dropped. */
+  void clear()
+  {
+    m_buckets.erase(std::remove_if(m_buckets.begin(), m_buckets.end(),
+                                   [](const Bucket& bucket) { return bucket.items.empty(); }),
+                    m_buckets.end());
+    for (auto& bucket : m_buckets)
+      bucket.items.clear();
+    m_last = 0;
+  }
+
+private:
+  size_t get_bucket(int layer)
+  {
+    auto it = std::lower_bound(m_buckets.begin(), m_buckets.end(), layer,
+                               [](const Bucket& bucket, int value) { return bucket.layer < value; });
+    if (it == m_buckets.end() || it->layer != layer)
+      it = m_buckets.insert(it, Bucket{ layer, {} });
+
+    return static_cast<size_t>(it - m_buckets.begin());
+  }
+
+private:
+  std::vector<Bucket> m_buckets;
+  size_t m_last;
+
+private:
+  LayerBuckets(const LayerBuckets&) = delete;
+  LayerBuckets& operator=(const LayerBuckets&) = delete;
+};
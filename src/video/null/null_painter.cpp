@@ -71,11 +71,17 @@ NullPainter::clear(const Color& color)
 }
 
 void
-NullPainter::get_pixel(const DrawingRequest& request) const
+NullPainter::get_pixel(const DrawingRequest& request)
 {
   log_info << "NullPainter::get_pixel()" << std::endl;
 }
 
+void
+NullPainter::flush_pixel_requests()
+{
+  log_info << "NullPainter::flush_pixel_requests()" << std::endl;
+}
+
 void
 NullPainter::set_clip_rect(const Rect& rect)
 {
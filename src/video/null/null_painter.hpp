@@ -34,7 +34,8 @@ public:
   virtual void draw_triangle(const DrawingRequest& request) override;
 
   virtual void clear(const Color& color) override;
-  virtual void get_pixel(const DrawingRequest& request) const override;
+  virtual void get_pixel(const DrawingRequest& request) override;
+  virtual void flush_pixel_requests() override;
 
   virtual void set_clip_rect(const Rect& rect) override;
   virtual void clear_clip_rect() override;
@@ -31,6 +31,11 @@ NullTexture::reload(const SDL_Surface&)
 {
 }
 
+void
+NullTexture::update(const SDL_Surface&, int, int)
+{
+}
+
 int
 NullTexture::get_texture_width() const
 {
@@ -27,6 +27,7 @@ public:
   ~NullTexture() override;
 
   virtual void reload(const SDL_Surface& image) override;
+  virtual void update(const SDL_Surface& image, int x, int y) override;
 
   virtual int get_texture_width() const override;
   virtual int get_texture_height() const override;
@@ -30,6 +30,7 @@ NullVideoSystem::NullVideoSystem() :
   m_viewport(Rect(0, 0, 1920, 1080), Vector(1.0f, 1.0f)),
   m_screen_renderer(new NullRenderer),
   m_lightmap_renderer(new NullRenderer),
+  m_static_lightmap_renderer(new NullRenderer),
   m_texture_manager(new TextureManager)
 {
 }
@@ -56,6 +57,12 @@ NullVideoSystem::get_lightmap() const
   return *m_lightmap_renderer;
 }
 
+Renderer&
+NullVideoSystem::get_static_lightmap() const
+{
+  return *m_static_lightmap_renderer;
+}
+
 TexturePtr
 NullVideoSystem::new_texture(const SDL_Surface& image, const Sampler& sampler)
 {
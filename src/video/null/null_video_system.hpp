@@ -35,6 +35,7 @@ public:
   virtual Renderer* get_back_renderer() const override;
   virtual Renderer& get_renderer() const override;
   virtual Renderer& get_lightmap() const override;
+  virtual Renderer& get_static_lightmap() const override;
 
   virtual TexturePtr new_texture(const SDL_Surface& image, const Sampler& sampler)  override;
 
@@ -57,6 +58,7 @@ private:
   Viewport m_viewport;
   std::unique_ptr<NullRenderer> m_screen_renderer;
   std::unique_ptr<NullRenderer> m_lightmap_renderer;
+  std::unique_ptr<NullRenderer> m_static_lightmap_renderer;
   std::unique_ptr<TextureManager> m_texture_manager;
 
 private:
@@ -46,7 +46,12 @@ public:
   virtual void draw_triangle(const DrawingRequest& request) = 0;
 
   virtual void clear(const Color& color) = 0;
-  virtual void get_pixel(const DrawingRequest& request) const = 0;
+  virtual void get_pixel(const DrawingRequest& request) = 0;
+
+  /** Answers the get_pixel() requests made since the last call, the
+      colors may only arrive a few frames later. Called by the Renderer
+      at the end of drawing. */
+  virtual void flush_pixel_requests() = 0;
 
   virtual void set_clip_rect(const Rect& rect) = 0;
   virtual void clear_clip_rect() = 0;
@@ -0,0 +1,171 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/render_stats.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "physfs/ofile_stream.hpp"
+#include "util/log.hpp"
+
+RenderStats RenderStats::s_current;
+RenderStats RenderStats::s_last;
+std::unique_ptr<std::ostream> RenderStats::s_recording;
+int RenderStats::s_frame = 0;
+
+void
+RenderStats::end_frame()
+{
+  if (s_recording)
+    s_current.write_csv(*s_recording);
+
+  // Swapped instead of copied, so that the layer list keeps its memory.
+  std::swap(s_last, s_current);
+  s_current.clear();
+  s_frame += 1;
+}
+
+void
+RenderStats::start_recording(const std::string& filename)
+{
+  try
+  {
+    s_recording = std::make_unique<OFileStream>(filename);
+    write_csv_header(*s_recording);
+    log_info << "Recording render stats to " << filename << std::endl;
+  }
+  catch (const std::exception& err)
+  {
+    s_recording.reset();
+    log_warning << "Couldn't record render stats: " << err.what() << std::endl;
+  }
+}
+
+void
+RenderStats::stop_recording()
+{
+  s_recording.reset();
+}
+
+RenderStats::RenderStats() :
+  requests(0),
+  merged_requests(0),
+  state_changes(0),
+  draw_calls(0),
+  texture_binds(0),
+  program_binds(0),
+  vertices(0),
+  lightmap_passes(0),
+  culled_objects(0),
+  static_light_updates(0),
+  text_layout_hits(0),
+  text_layout_misses(0),
+  covered_pixels(0.0f),
+  screen_pixels(0.0f),
+  render_time(0.0f),
+  layer_requests()
+{
+}
+
+void
+RenderStats::clear()
+{
+  requests = 0;
+  merged_requests = 0;
+  state_changes = 0;
+  draw_calls = 0;
+  texture_binds = 0;
+  program_binds = 0;
+  vertices = 0;
+  lightmap_passes = 0;
+  culled_objects = 0;
+  static_light_updates = 0;
+  text_layout_hits = 0;
+  text_layout_misses = 0;
+  covered_pixels = 0.0f;
+  screen_pixels = 0.0f;
+  render_time = 0.0f;
+  layer_requests.clear();
+}
+
+void
+RenderStats::add_layer_requests(int layer, int count)
+{
+  auto it = std::lower_bound(layer_requests.begin(), layer_requests.end(), layer,
+                             [](const LayerRequests& lhs, int rhs) { return lhs.layer < rhs; });
+  if (it == layer_requests.end() || it->layer != layer)
+    it = layer_requests.insert(it, { layer, 0 });
+  it->requests += count;
+}
+
+float
+RenderStats::get_overdraw() const
+{
+  return screen_pixels > 0.0f ? covered_pixels / screen_pixels : 0.0f;
+}
+
+float
+RenderStats::get_text_layout_hit_rate() const
+{
+  const int lookups = text_layout_hits + text_layout_misses;
+  return lookups > 0 ? static_cast<float>(text_layout_hits) / static_cast<float>(lookups) : 0.0f;
+}
+
+void
+RenderStats::write(std::ostream& out) const
+{
+  out << "render:begin" << std::endl;
+  out << "  requests:" << requests << std::endl;
+  out << "  merged_requests:" << merged_requests << std::endl;
+  out << "  state_changes:" << state_changes << std::endl;
+  out << "  draw_calls:" << draw_calls << std::endl;
+  out << "  texture_binds:" << texture_binds << std::endl;
+  out << "  program_binds:" << program_binds << std::endl;
+  out << "  vertices:" << vertices << std::endl;
+  out << "  lightmap_passes:" << lightmap_passes << std::endl;
+  out << "  culled_objects:" << culled_objects << std::endl;
+  out << "  static_light_updates:" << static_light_updates << std::endl;
+  out << "  text_layout_hits:" << text_layout_hits << std::endl;
+  out << "  text_layout_misses:" << text_layout_misses << std::endl;
+  out << "  overdraw:" << get_overdraw() << std::endl;
+  out << "  render_time_ms:" << render_time << std::endl;
+  for (const auto& layer : layer_requests)
+    out << "  layer:" << layer.layer << " requests:" << layer.requests << std::endl;
+  out << "render:end" << std::endl;
+}
+
+void
+RenderStats::write_csv_header(std::ostream& out)
+{
+  out << "frame,requests,merged_requests,state_changes,draw_calls,texture_binds,program_binds,"
+      << "vertices,lightmap_passes,culled_objects,static_light_updates,"
+      << "text_layout_hits,text_layout_misses,overdraw,render_time_ms,layer_requests" << std::endl;
+}
+
+void
+RenderStats::write_csv(std::ostream& out) const
+{
+  out << s_frame << ',' << requests << ',' << merged_requests << ',' << state_changes << ','
+      << draw_calls << ',' << texture_binds << ',' << program_binds << ',' << vertices << ','
+      << lightmap_passes << ',' << culled_objects << ',' << static_light_updates << ','
+      << text_layout_hits << ',' << text_layout_misses << ',' << get_overdraw() << ',' << render_time << ',';
+
+  // All layers in one column, as "layer:requests" separated by spaces.
+  for (size_t i = 0; i < layer_requests.size(); ++i)
+    out << (i ? " " : "") << layer_requests[i].layer << ':' << layer_requests[i].requests;
+  out << '\n';
+}
@@ -0,0 +1,107 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Counters of the work the renderer did in one frame. They are filled
+ * in by the GameObjectManager, Canvas, the painters and the
+ * Compositor, shown with "Show Draw Stats" and can be recorded to a
+ * CSV file, one line per frame.
+ */
+class RenderStats final
+{
+public:
+  struct LayerRequests
+  {
+    int layer;
+    int requests;
+  };
+
+public:
+  /** Counters of the frame that is rendered right now */
+  static RenderStats& current() { return s_current; }
+
+  /** Counters of the last complete frame */
+  static const RenderStats& last() { return s_last; }
+
+  /** Called by the Compositor when a frame is complete */
+  static void end_frame();
+
+  /** Writes the counters of every following frame to filename in the
+      user directory, until stop_recording() is called. */
+  static void start_recording(const std::string& filename);
+  static void stop_recording();
+  static bool is_recording() { return static_cast<bool>(s_recording); }
+
+public:
+  RenderStats();
+
+  void clear();
+
+  /** Counts a call into the graphics API that draws vertices */
+  inline void add_draw_call(int count)
+  {
+    draw_calls += 1;
+    vertices += count;
+  }
+
+  void add_layer_requests(int layer, int count);
+
+  /** Fraction of the text layouts found in the cache */
+  float get_text_layout_hit_rate() const;
+
+  /** Screen pixels covered by textures per pixel of the screen, the
+      average amount of times each pixel was drawn. */
+  float get_overdraw() const;
+
+  /** Writes the counters as key:value lines, like the dumps of the
+      collision system and the texture cache. */
+  void write(std::ostream& out) const;
+
+public:
+  int requests; /**< drawing requests handed to the painters */
+  int merged_requests; /**< requests merged into the one before them */
+  int state_changes; /**< requests needing another texture, blend mode or clip rect */
+  int draw_calls; /**< calls into the graphics API */
+  int texture_binds;
+  int program_binds;
+  int vertices;
+  int lightmap_passes; /**< contexts rendered into the lightmap */
+  int culled_objects; /**< game objects not drawn for being outside of the screen */
+  int static_light_updates; /**< redraws of the cached static lights */
+  int text_layout_hits; /**< text widths and wraps found in the layout cache of a Font */
+  int text_layout_misses;
+  float covered_pixels; /**< area of all drawn textures, for get_overdraw() */
+  float screen_pixels;
+  float render_time; /**< time spent in Compositor::render(), in milliseconds */
+  std::vector<LayerRequests> layer_requests; /**< ordered by layer */
+
+private:
+  static void write_csv_header(std::ostream& out);
+  void write_csv(std::ostream& out) const;
+
+private:
+  static RenderStats s_current;
+  static RenderStats s_last;
+  static std::unique_ptr<std::ostream> s_recording;
+  static int s_frame;
+};
@@ -26,6 +26,7 @@
 #include "math/util.hpp"
 #include "util/log.hpp"
 #include "video/drawing_request.hpp"
+#include "video/render_stats.hpp"
 #include "video/renderer.hpp"
 #include "video/sdl/sdl_texture.hpp"
 #include "video/sdl/sdl_video_system.hpp"
@@ -212,7 +213,9 @@ SDLPainter::SDLPainter(SDLVideoSystem& video_system, Renderer& renderer, SDL_Ren
   m_video_system(video_system),
   m_renderer(renderer),
   m_sdl_renderer(sdl_renderer),
-  m_cliprect()
+  m_cliprect(),
+  m_quad_batch(),
+  m_pixel_requests()
 {}
 
 void
@@ -220,41 +223,87 @@ SDLPainter::draw_texture(const DrawingRequest& draw_req)
 {
   auto&& request = std::get<TextureRequest>(draw_req.request);
   const auto& texture = static_cast<const SDLTexture&>(*request.texture);
+  SDL_Texture* sdl_texture = texture.get_texture();
 
   assert(request.srcrects.size() == request.dstrects.size());
   assert(request.srcrects.size() == request.angles.size());
 
-  for (size_t i = 0; i < request.srcrects.size(); ++i)
+  RenderStats& stats = RenderStats::current();
+  stats.texture_binds += 1;
+
+  SDL_SetTextureScaleMode(sdl_texture, SDL_SCALEMODE_LINEAR);
+  SDL_SetTextureBlendMode(sdl_texture, blend2sdl(draw_req.blend));
+
+  SDL_FlipMode flip = SDL_FLIP_NONE;
+  if ((draw_req.flip & HORIZONTAL_FLIP) != 0)
   {
-    const SDL_Rect& src_rect = request.srcrects[i].to_rect().to_sdl();
-    const SDL_FRect& dst_rect = request.dstrects[i].to_sdl();
+    flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_HORIZONTAL);
+  }
 
-    Uint8 r = static_cast<Uint8>(request.color.red * 255);
-    Uint8 g = static_cast<Uint8>(request.color.green * 255);
-    Uint8 b = static_cast<Uint8>(request.color.blue * 255);
-    Uint8 a = static_cast<Uint8>(request.color.alpha * draw_req.alpha * 255);
+  if ((draw_req.flip & VERTICAL_FLIP) != 0)
+  {
+    flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_VERTICAL);
+  }
 
-    SDL_SetTextureScaleMode(texture.get_texture(), SDL_SCALEMODE_LINEAR);
-    SDL_SetTextureColorMod(texture.get_texture(), r, g, b);
-    SDL_SetTextureAlphaMod(texture.get_texture(), a);
-    SDL_SetTextureBlendMode(texture.get_texture(), blend2sdl(draw_req.blend));
+  const SDL_FColor color{ request.color.red, request.color.green, request.color.blue,
+                          request.color.alpha * draw_req.alpha };
 
-    SDL_FlipMode flip = SDL_FLIP_NONE;
-    if ((draw_req.flip & HORIZONTAL_FLIP) != 0)
-    {
-      flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_HORIZONTAL);
-    }
+  const float width = static_cast<float>(texture.get_image_width());
+  const float height = static_cast<float>(texture.get_image_height());
+
+  // Animated textures and srcrects reaching outside of the texture
+  // have to be split up into several rects, which RenderCopyEx()
+  // does, everything else is batched into a single
+  // SDL_RenderGeometry() call, which is modulated by the vertex color.
+  const Vector animate = texture.get_sampler().get_animate();
+  const bool batchable = (animate.x == 0.0f && animate.y == 0.0f);
+
+  auto flush = [this, &stats, sdl_texture]
+  {
+    if (m_quad_batch.empty())
+      return;
+
+    stats.add_draw_call(static_cast<int>(m_quad_batch.size()) * 4);
+    if (!m_quad_batch.render(m_sdl_renderer, sdl_texture))
+      log_warning << "SDL_RenderGeometry failed: " << SDL_GetError() << std::endl;
+  };
+
+  SDL_SetTextureColorModFloat(sdl_texture, 1.0f, 1.0f, 1.0f);
+  SDL_SetTextureAlphaModFloat(sdl_texture, 1.0f);
+
+  for (size_t i = 0; i < request.srcrects.size(); ++i)
+  {
+    const Rectf& srcrect = request.srcrects[i];
+    const Rectf& dstrect = request.dstrects[i];
+    stats.covered_pixels += dstrect.get_width() * dstrect.get_height();
 
-    if ((draw_req.flip & VERTICAL_FLIP) != 0)
+    if (batchable &&
+        srcrect.get_left() >= 0.0f && srcrect.get_top() >= 0.0f &&
+        srcrect.get_right() <= width && srcrect.get_bottom() <= height)
     {
-      flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_VERTICAL);
+      m_quad_batch.add(srcrect, dstrect, request.angles[i], flip, color, width, height);
+      continue;
     }
 
-    RenderCopyEx(m_sdl_renderer, texture.get_texture(),
+    flush();
+
+    const SDL_Rect& src_rect = srcrect.to_rect().to_sdl();
+    const SDL_FRect& dst_rect = dstrect.to_sdl();
+    stats.add_draw_call(4);
+
+    SDL_SetTextureColorModFloat(sdl_texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaModFloat(sdl_texture, color.a);
+
+    RenderCopyEx(m_sdl_renderer, sdl_texture,
                  &src_rect, &dst_rect,
                  static_cast<double>(request.angles[i]), nullptr, flip,
                  texture.get_sampler());
+
+    SDL_SetTextureColorModFloat(sdl_texture, 1.0f, 1.0f, 1.0f);
+    SDL_SetTextureAlphaModFloat(sdl_texture, 1.0f);
   }
+
+  flush();
 }
 
 void
@@ -358,6 +407,7 @@ SDLPainter::draw_gradient(const DrawingRequest& draw_req)
     SDL_SetRenderDrawBlendMode(m_sdl_renderer, blend2sdl(draw_req.blend));
     SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
     SDL_RenderFillRect(m_sdl_renderer, &rectf);
+    RenderStats::current().add_draw_call(4);
   }
 }
 
@@ -419,6 +469,7 @@ SDLPainter::draw_filled_rect(const DrawingRequest& draw_req)
     SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
     SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
     SDL_RenderFillRects(m_sdl_renderer, &*rects.begin(), static_cast<int>(rects.size()));
+    RenderStats::current().add_draw_call(static_cast<int>(rects.size()) * 4);
   }
   else
   {
@@ -427,6 +478,7 @@ SDLPainter::draw_filled_rect(const DrawingRequest& draw_req)
       SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
       SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
       SDL_RenderFillRect(m_sdl_renderer, &rect);
+      RenderStats::current().add_draw_call(4);
     }
   }
 }
@@ -486,6 +538,7 @@ SDLPainter::draw_inverse_ellipse(const DrawingRequest& draw_req)
   SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
   SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
   SDL_RenderFillRects(m_sdl_renderer, rects, 2*slices+2);
+  RenderStats::current().add_draw_call((2*slices+2) * 4);
 }
 
 void
@@ -501,6 +554,7 @@ SDLPainter::draw_line(const DrawingRequest& draw_req)
   SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
   SDL_RenderLine(m_sdl_renderer, request.pos.x, request.pos.y,
                  request.dest_pos.x, request.dest_pos.y);
+  RenderStats::current().add_draw_call(2);
 }
 
 namespace {
@@ -633,27 +687,56 @@ SDLPainter::clear_clip_rect()
 }
 
 void
-SDLPainter::get_pixel(const DrawingRequest& draw_req) const
+SDLPainter::get_pixel(const DrawingRequest& draw_req)
 {
   auto&& request = std::get<GetPixelRequest>(draw_req.request);
   const Rect& rect = m_renderer.get_rect();
   const Size& logical_size = m_renderer.get_logical_size();
 
+  // Reading pixels back is slow, all requests of a frame are answered
+  // by a single read in flush_pixel_requests().
+  m_pixel_requests.push_back({
+      rect.left + static_cast<int>(request.pos.x * static_cast<float>(rect.get_width()) / static_cast<float>(logical_size.width)),
+      rect.top + static_cast<int>(request.pos.y * static_cast<float>(rect.get_height()) / static_cast<float>(logical_size.height)),
+      request.color_ptr });
+}
+
+void
+SDLPainter::flush_pixel_requests()
+{
+  if (m_pixel_requests.empty())
+    return;
+
   SDL_Rect srcrect;
-  srcrect.x = rect.left + static_cast<int>(request.pos.x * static_cast<float>(rect.get_width()) / static_cast<float>(logical_size.width));
-  srcrect.y = rect.top + static_cast<int>(request.pos.y * static_cast<float>(rect.get_height()) / static_cast<float>(logical_size.height));
-  srcrect.w = 1;
-  srcrect.h = 1;
-
-  auto surface = SDL_RenderReadPixels(m_sdl_renderer, &srcrect);
-  auto error = SDL_GetError();
-  if (error != nullptr)
+  srcrect.x = m_pixel_requests.front().x;
+  srcrect.y = m_pixel_requests.front().y;
+  int right = srcrect.x + 1;
+  int bottom = srcrect.y + 1;
+  for (const auto& request : m_pixel_requests)
+  {
+    srcrect.x = std::min(srcrect.x, request.x);
+    srcrect.y = std::min(srcrect.y, request.y);
+    right = std::max(right, request.x + 1);
+    bottom = std::max(bottom, request.y + 1);
+  }
+  srcrect.w = right - srcrect.x;
+  srcrect.h = bottom - srcrect.y;
+
+  SDL_Surface* surface = SDL_RenderReadPixels(m_sdl_renderer, &srcrect);
+  if (!surface)
   {
-    log_warning << "failed to read pixels: " << error << std::endl;
+    log_warning << "failed to read pixels: " << SDL_GetError() << std::endl;
+    m_pixel_requests.clear();
+    return;
   }
 
-  auto pixel = static_cast<Uint8*>(surface->pixels);
-  *(request.color_ptr) = Color::from_rgb888(pixel[2], pixel[1], pixel[0]);
+  for (const auto& request : m_pixel_requests)
+  {
+    Uint8 r = 0, g = 0, b = 0, a = 0;
+    SDL_ReadSurfacePixel(surface, request.x - srcrect.x, request.y - srcrect.y, &r, &g, &b, &a);
+    *(request.color) = Color::from_rgb888(r, g, b);
+  }
 
   SDL_DestroySurface(surface);
+  m_pixel_requests.clear();
 }
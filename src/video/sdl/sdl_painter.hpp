@@ -18,7 +18,11 @@
 
 #include "video/painter.hpp"
 
+#include <memory>
 #include <optional>
+#include <vector>
+
+#include "video/sdl/sdl_quad_batch.hpp"
 
 class Renderer;
 class SDLScreenRenderer;
@@ -39,16 +43,27 @@ public:
   virtual void draw_triangle(const DrawingRequest& request) override;
 
   virtual void clear(const Color& color) override;
-  virtual void get_pixel(const DrawingRequest& request) const override;
+  virtual void get_pixel(const DrawingRequest& request) override;
+  virtual void flush_pixel_requests() override;
 
   virtual void set_clip_rect(const Rect& rect) override;
   virtual void clear_clip_rect() override;
 
+private:
+  struct PixelRequest
+  {
+    int x;
+    int y;
+    std::shared_ptr<Color> color;
+  };
+
 private:
   SDLVideoSystem& m_video_system;
   Renderer& m_renderer;
   SDL_Renderer* m_sdl_renderer;
   std::optional<SDL_Rect> m_cliprect;
+  SDLQuadBatch m_quad_batch;
+  std::vector<PixelRequest> m_pixel_requests;
 
 private:
   SDLPainter(const SDLPainter&) = delete;
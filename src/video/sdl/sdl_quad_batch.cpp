@@ -0,0 +1,107 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/sdl/sdl_quad_batch.hpp"
+
+#include <math.h>
+#include <utility>
+
+#include "math/rectf.hpp"
+
+SDLQuadBatch::SDLQuadBatch() :
+  m_vertices(),
+  m_indices()
+{
+}
+
+void
+SDLQuadBatch::clear()
+{
+  m_vertices.clear();
+  m_indices.clear();
+}
+
+void
+SDLQuadBatch::add(const Rectf& srcrect, const Rectf& dstrect, float angle, SDL_FlipMode flip,
+                  const SDL_FColor& color, float texture_width, float texture_height)
+{
+  float uv_left = srcrect.get_left() / texture_width;
+  float uv_right = srcrect.get_right() / texture_width;
+  float uv_top = srcrect.get_top() / texture_height;
+  float uv_bottom = srcrect.get_bottom() / texture_height;
+
+  if ((flip & SDL_FLIP_HORIZONTAL) != 0)
+    std::swap(uv_left, uv_right);
+  if ((flip & SDL_FLIP_VERTICAL) != 0)
+    std::swap(uv_top, uv_bottom);
+
+  const float center_x = dstrect.get_left() + dstrect.get_width() / 2.0f;
+  const float center_y = dstrect.get_top() + dstrect.get_height() / 2.0f;
+  const float half_width = dstrect.get_width() / 2.0f;
+  const float half_height = dstrect.get_height() / 2.0f;
+
+  // Corners relative to the center, in the order top-left, top-right,
+  // bottom-right, bottom-left.
+  const float corners[4][2] = {
+    { -half_width, -half_height },
+    { half_width, -half_height },
+    { half_width, half_height },
+    { -half_width, half_height }
+  };
+  const float uvs[4][2] = {
+    { uv_left, uv_top },
+    { uv_right, uv_top },
+    { uv_right, uv_bottom },
+    { uv_left, uv_bottom }
+  };
+
+  float sin_angle = 0.0f;
+  float cos_angle = 1.0f;
+  if (angle != 0.0f)
+  {
+    const float rad = angle * static_cast<float>(M_PI) / 180.0f;
+    sin_angle = sinf(rad);
+    cos_angle = cosf(rad);
+  }
+
+  const int first = static_cast<int>(m_vertices.size());
+  for (int i = 0; i < 4; ++i)
+  {
+    SDL_Vertex vertex;
+    vertex.position.x = center_x + corners[i][0] * cos_angle - corners[i][1] * sin_angle;
+    vertex.position.y = center_y + corners[i][0] * sin_angle + corners[i][1] * cos_angle;
+    vertex.color = color;
+    vertex.tex_coord.x = uvs[i][0];
+    vertex.tex_coord.y = uvs[i][1];
+    m_vertices.push_back(vertex);
+  }
+
+  for (const int index : { 0, 1, 2, 0, 2, 3 })
+    m_indices.push_back(first + index);
+}
+
+bool
+SDLQuadBatch::render(SDL_Renderer* renderer, SDL_Texture* texture)
+{
+  if (m_vertices.empty())
+    return true;
+
+  const bool result = SDL_RenderGeometry(renderer, texture,
+                                         m_vertices.data(), static_cast<int>(m_vertices.size()),
+                                         m_indices.data(), static_cast<int>(m_indices.size()));
+  clear();
+  return result;
+}
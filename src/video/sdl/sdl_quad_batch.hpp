@@ -0,0 +1,59 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+class Rectf;
+
+/**
+ * Collects the quads of a texture request as triangles, so that they
+ * can be submitted with a single SDL_RenderGeometry() call instead of
+ * one SDL_RenderTextureRotated() call per quad.
+ *
+ * Rotation and flipping follow SDL_RenderTextureRotated(): the quad is
+ * flipped first and then rotated clockwise around its center.
+ */
+class SDLQuadBatch final
+{
+public:
+  SDLQuadBatch();
+
+  /** Removes all quads, the allocated memory is kept. */
+  void clear();
+
+  /** Adds the area srcrect of a texture with the given size, drawn to
+      dstrect. */
+  void add(const Rectf& srcrect, const Rectf& dstrect, float angle, SDL_FlipMode flip,
+           const SDL_FColor& color, float texture_width, float texture_height);
+
+  /** Draws all quads with texture and clears the batch. Returns false
+      if SDL_RenderGeometry() failed. */
+  bool render(SDL_Renderer* renderer, SDL_Texture* texture);
+
+  inline bool empty() const { return m_vertices.empty(); }
+  inline size_t size() const { return m_vertices.size() / 4; }
+
+private:
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+
+private:
+  SDLQuadBatch(const SDLQuadBatch&) = delete;
+  SDLQuadBatch& operator=(const SDLQuadBatch&) = delete;
+};
@@ -82,6 +82,7 @@ SDLScreenRenderer::start_draw()
 void
 SDLScreenRenderer::end_draw()
 {
+  m_painter.flush_pixel_requests();
 }
 
 Rect
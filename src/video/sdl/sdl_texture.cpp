@@ -20,6 +20,7 @@
 #include <sstream>
 
 #include "video/sdl/sdl_screen_renderer.hpp"
+#include "video/sdl_surface_ptr.hpp"
 #include "video/video_system.hpp"
 
 SDLTexture::SDLTexture(SDL_Texture* texture, int width, int height, const Sampler& sampler) :
@@ -57,6 +58,26 @@ SDLTexture::reload(const SDL_Surface& image)
   m_height = image.h;
 }
 
+void
+SDLTexture::update(const SDL_Surface& image, int x, int y)
+{
+  SDLSurfacePtr convert(SDL_ConvertSurface(const_cast<SDL_Surface*>(&image), m_texture->format));
+  if (!convert)
+  {
+    std::ostringstream msg;
+    msg << "couldn't convert surface: " << SDL_GetError();
+    throw std::runtime_error(msg.str());
+  }
+
+  const SDL_Rect rect{x, y, image.w, image.h};
+  if (!SDL_UpdateTexture(m_texture, &rect, convert->pixels, convert->pitch))
+  {
+    std::ostringstream msg;
+    msg << "couldn't update texture: " << SDL_GetError();
+    throw std::runtime_error(msg.str());
+  }
+}
+
 SDLTexture::~SDLTexture()
 {
   SDL_DestroyTexture(m_texture);
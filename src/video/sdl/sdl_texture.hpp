@@ -30,6 +30,7 @@ public:
   ~SDLTexture() override;
 
   virtual void reload(const SDL_Surface& image) override;
+  virtual void update(const SDL_Surface& image, int x, int y) override;
 
   virtual int get_texture_width() const override { return m_width; }
   virtual int get_texture_height() const override { return m_height; }
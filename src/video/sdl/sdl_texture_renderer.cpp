@@ -77,6 +77,8 @@ SDLTextureRenderer::start_draw()
 void
 SDLTextureRenderer::end_draw()
 {
+  m_painter.flush_pixel_requests();
+
   SDL_SetRenderScale(m_renderer, 1.0f, 1.0f);
   SDL_SetRenderTarget(m_renderer, nullptr);
 }
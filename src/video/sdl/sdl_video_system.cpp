@@ -36,6 +36,7 @@ SDLVideoSystem::SDLVideoSystem() :
   m_viewport(),
   m_renderer(),
   m_lightmap(),
+  m_static_lightmap(),
   m_texture_manager()
 {
   create_window();
@@ -95,6 +96,7 @@ SDLVideoSystem::apply_config()
   }
 
   m_lightmap.reset(new SDLTextureRenderer(*this, m_sdl_renderer.get(), m_viewport.get_screen_size(), 5));
+  m_static_lightmap.reset(new SDLTextureRenderer(*this, m_sdl_renderer.get(), m_viewport.get_screen_size() * 2, 5));
 }
 
 Renderer&
@@ -109,6 +111,12 @@ SDLVideoSystem::get_lightmap() const
   return *m_lightmap;
 }
 
+Renderer&
+SDLVideoSystem::get_static_lightmap() const
+{
+  return *m_static_lightmap;
+}
+
 TexturePtr
 SDLVideoSystem::new_texture(const SDL_Surface& image, const Sampler& sampler)
 {
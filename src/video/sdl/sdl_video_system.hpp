@@ -38,6 +38,7 @@ public:
   virtual Renderer* get_back_renderer() const override { return nullptr; }
   virtual Renderer& get_renderer() const override;
   virtual Renderer& get_lightmap() const override;
+  virtual Renderer& get_static_lightmap() const override;
 
   virtual TexturePtr new_texture(const SDL_Surface& image, const Sampler& sampler) override;
 
@@ -58,6 +59,7 @@ private:
   Viewport m_viewport;
   std::unique_ptr<SDLScreenRenderer> m_renderer;
   std::unique_ptr<SDLTextureRenderer> m_lightmap;
+  std::unique_ptr<SDLTextureRenderer> m_static_lightmap;
   std::unique_ptr<TextureManager> m_texture_manager;
 
 private:
@@ -0,0 +1,117 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/static_light_cache.hpp"
+
+#include "math/rectf.hpp"
+#include "video/drawing_context.hpp"
+#include "video/drawing_request.hpp"
+#include "video/painter.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+
+StaticLightCache::StaticLightCache() :
+  m_valid(false),
+  m_fingerprint(0),
+  m_origin(0.0f, 0.0f),
+  m_scale(1.0f),
+  m_texture(nullptr)
+{
+}
+
+bool
+StaticLightCache::update(DrawingContext& context, Renderer& renderer)
+{
+  Canvas& canvas = context.get_static_light_canvas();
+  const DrawingTransform& transform = context.get_static_light_transform();
+
+  const Size size = renderer.get_logical_size();
+  const Sizef area(static_cast<float>(size.width) / transform.scale,
+                   static_cast<float>(size.height) / transform.scale);
+  const Rectf view(transform.translation,
+                   Sizef(static_cast<float>(transform.viewport.get_width()) / transform.scale,
+                         static_cast<float>(transform.viewport.get_height()) / transform.scale));
+
+  const uint64_t fingerprint = canvas.get_fingerprint();
+  const TexturePtr texture = renderer.get_texture();
+
+  if (m_valid && texture.get() == m_texture &&
+      fingerprint == m_fingerprint && transform.scale == m_scale &&
+      view.get_left() >= m_origin.x && view.get_top() >= m_origin.y &&
+      view.get_right() <= m_origin.x + area.width &&
+      view.get_bottom() <= m_origin.y + area.height)
+  {
+    return false;
+  }
+
+  // Center the cached area on the visible area, so the camera can move
+  // half a screen into every direction.
+  m_origin = Vector(view.get_left() - (area.width - view.get_width()) / 2.0f,
+                    view.get_top() - (area.height - view.get_height()) / 2.0f);
+  m_scale = transform.scale;
+  m_fingerprint = fingerprint;
+
+  canvas.transform_requests(m_origin, m_scale);
+
+  renderer.start_draw();
+  renderer.get_painter().clear(Color::BLACK);
+  canvas.render(renderer, Canvas::ALL);
+  renderer.end_draw();
+
+  m_texture = renderer.get_texture().get();
+  m_valid = (m_texture != nullptr);
+  return true;
+}
+
+void
+StaticLightCache::draw(DrawingContext& context, Renderer& renderer, Painter& painter) const
+{
+  const TexturePtr texture = renderer.get_texture();
+  if (!m_valid || !texture)
+    return;
+
+  DrawingTransform transform = context.get_static_light_transform();
+  transform.flip = NO_FLIP;
+  transform.alpha = 1.0f;
+
+  DrawingRequest request(transform);
+  auto&& req_var = std::get<TextureRequest>(request.request);
+
+  // The lights were drawn on black, so adding them up gives the same
+  // result as drawing each of them into the lightmap.
+  request.blend = Blend::ADD;
+
+  const Vector viewport_pos(static_cast<float>(transform.viewport.left),
+                            static_cast<float>(transform.viewport.top));
+  const Size size = renderer.get_logical_size();
+
+  Rectf srcrect(0.0f, 0.0f,
+                static_cast<float>(texture->get_image_width()),
+                static_cast<float>(texture->get_image_height()));
+  Rectf dstrect((m_origin - transform.translation + viewport_pos) * m_scale,
+                Sizef(static_cast<float>(size.width), static_cast<float>(size.height)));
+  float angle = 0.0f;
+  req_var.srcrects = Span<Rectf>(&srcrect, 1);
+  req_var.dstrects = Span<Rectf>(&dstrect, 1);
+  req_var.angles = Span<float>(&angle, 1);
+
+  req_var.texture = texture.get();
+  req_var.color = Color::WHITE;
+
+  painter.set_clip_rect(transform.viewport);
+  painter.draw_texture(request);
+  painter.clear_clip_rect();
+}
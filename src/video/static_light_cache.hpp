@@ -0,0 +1,68 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "math/vector.hpp"
+
+class DrawingContext;
+class Painter;
+class Renderer;
+class Texture;
+
+/**
+ * Keeps the static lights of a DrawingContext in a texture, see
+ * DrawingContext::static_light().
+ *
+ * The texture covers an area of the world around the visible area,
+ * so it can be reused while the camera moves. It is only redrawn when
+ * the static lights change, when the visible area leaves the cached
+ * area or when the scale changes. Changes are found by comparing the
+ * fingerprints of the requests, as the requests are kept in world
+ * coordinates.
+ */
+class StaticLightCache final
+{
+public:
+  StaticLightCache();
+
+  /** Redraws the static lights of context into renderer, if needed.
+      Returns true if they were redrawn. */
+  bool update(DrawingContext& context, Renderer& renderer);
+
+  /** Adds the cached lights to the lightmap that painter draws to.
+      The dynamic lights in the layers of the static lights have to be
+      additive, see Canvas::is_additive(). */
+  void draw(DrawingContext& context, Renderer& renderer, Painter& painter) const;
+
+private:
+  bool m_valid;
+  uint64_t m_fingerprint;
+
+  /** Top left corner of the cached area in world coordinates */
+  Vector m_origin;
+  float m_scale;
+
+  /** The texture the lights were drawn to, the texture is recreated
+      when the video system changes. */
+  const Texture* m_texture;
+
+private:
+  StaticLightCache(const StaticLightCache&) = delete;
+  StaticLightCache& operator=(const StaticLightCache&) = delete;
+};
@@ -74,11 +74,9 @@ Surface::from_file(const std::string& filename, const std::optional<Rect>& rect)
   }
   else
   {
-    auto textureManager = TextureManager::current();
-    TexturePtr texture = rect ?
-      textureManager->get(filename, *rect) : textureManager->get(filename);
-
-    return SurfacePtr(new Surface(texture, TexturePtr(), NO_FLIP, filename));
+    Rect region;
+    TexturePtr texture = TextureManager::current()->get_packed(filename, rect, region);
+    return SurfacePtr(new Surface(texture, TexturePtr(), region, NO_FLIP, filename));
   }
 }
 
@@ -130,7 +128,8 @@ Surface::region(const Rect& rect) const
 {
   SurfacePtr surface(new Surface(m_diffuse_texture,
                                  m_displacement_texture,
-                                 rect,
+                                 Rect(m_region.left + rect.left, m_region.top + rect.top,
+                                      m_region.left + rect.right, m_region.top + rect.bottom),
                                  m_flip));
   return surface;
 }
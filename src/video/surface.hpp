@@ -45,6 +45,8 @@ private:
 public:
   ~Surface();
 
+  /** Returns the given part of this surface, rect is relative to the
+      top left corner of the surface. */
   SurfacePtr region(const Rect& rect) const;
   SurfacePtr clone(Flip flip = NO_FLIP) const;
 
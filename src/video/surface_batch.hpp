@@ -34,9 +34,9 @@ public:
   void draw(const Rectf& dstrect, float angle = 0.0f);
   void draw(const Rectf& srcrect, const Rectf& dstrect, float angle = 0.0f);
 
-  inline std::vector<Rectf> move_srcrects() { return std::move(m_srcrects); }
-  inline std::vector<Rectf> move_dstrects() { return std::move(m_dstrects); }
-  inline std::vector<float> move_angles() { return std::move(m_angles); }
+  inline const std::vector<Rectf>& get_srcrects() const { return m_srcrects; }
+  inline const std::vector<Rectf>& get_dstrects() const { return m_dstrects; }
+  inline const std::vector<float>& get_angles() const { return m_angles; }
 
   inline Color get_color() const { return m_color; }
 
@@ -46,6 +46,10 @@ public:
 
   virtual void reload(const SDL_Surface& image) = 0;
 
+  /** Replaces the part of the texture at (x, y) with image, used to
+      fill texture atlas pages. */
+  virtual void update(const SDL_Surface& image, int x, int y) = 0;
+
   virtual int get_texture_width() const = 0;
   virtual int get_texture_height() const = 0;
 
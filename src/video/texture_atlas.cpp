@@ -0,0 +1,79 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/texture_atlas.hpp"
+
+TextureAtlas::TextureAtlas(int width, int height, int padding) :
+  m_width(width),
+  m_height(height),
+  m_padding(padding),
+  m_shelves(),
+  m_shelves_bottom(0),
+  m_count(0),
+  m_used_area(0)
+{
+}
+
+std::optional<Rect>
+TextureAtlas::insert(const Size& size)
+{
+  if (size.width <= 0 || size.height <= 0)
+    return std::nullopt;
+
+  const int width = size.width + 2 * m_padding;
+  const int height = size.height + 2 * m_padding;
+  if (width > m_width || height > m_height)
+    return std::nullopt;
+
+  // Take the lowest shelf the image fits on, so that tall shelves
+  // stay free for tall images.
+  Shelf* best = nullptr;
+  for (auto& shelf : m_shelves)
+  {
+    if (shelf.height < height || shelf.right + width > m_width)
+      continue;
+    if (!best || shelf.height < best->height)
+      best = &shelf;
+  }
+
+  // A shelf much higher than the image would waste the space above
+  // it, start a new one while there is room for it.
+  const bool wasteful = best && (best->height - height) * 2 > height;
+  if ((!best || wasteful) && m_shelves_bottom + height <= m_height)
+  {
+    m_shelves.push_back({ m_shelves_bottom, height, 0 });
+    m_shelves_bottom += height;
+    best = &m_shelves.back();
+  }
+
+  if (!best)
+    return std::nullopt;
+
+  const Rect rect(best->right + m_padding, best->top + m_padding, size);
+  best->right += width;
+
+  m_count += 1;
+  m_used_area += static_cast<int64_t>(size.width) * static_cast<int64_t>(size.height);
+
+  return rect;
+}
+
+float
+TextureAtlas::get_occupancy() const
+{
+  return static_cast<float>(m_used_area) /
+         (static_cast<float>(m_width) * static_cast<float>(m_height));
+}
@@ -0,0 +1,78 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <optional>
+#include <stdint.h>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "math/size.hpp"
+
+/**
+ * Keeps track of the free space on a texture page that is shared by
+ * many small images, so that they can be drawn with a single texture.
+ *
+ * The images are placed on shelves: rows as high as the first image
+ * placed on them, that are filled from left to right. Images of
+ * similar height, like tiles, sprite frames and glyphs, waste little
+ * space that way. Space is never given back, a page is dropped as a
+ * whole once all of its images are gone.
+ */
+class TextureAtlas final
+{
+public:
+  /** padding is the amount of pixels kept free on each side of an
+      image, so that filtering doesn't pick up its neighbours. */
+  TextureAtlas(int width, int height, int padding = 1);
+
+  /** Reserves room for an image of the given size and returns the area
+      of the image on the page, or nothing if the page is full. */
+  std::optional<Rect> insert(const Size& size);
+
+  inline int get_width() const { return m_width; }
+  inline int get_height() const { return m_height; }
+  inline int get_padding() const { return m_padding; }
+
+  /** Returns the amount of images on the page. */
+  inline int get_count() const { return m_count; }
+
+  /** Returns the fraction of the page covered by images, padding not
+      included. */
+  float get_occupancy() const;
+
+private:
+  struct Shelf
+  {
+    int top;
+    int height;
+    int right;
+  };
+
+private:
+  int m_width;
+  int m_height;
+  int m_padding;
+  std::vector<Shelf> m_shelves;
+  int m_shelves_bottom;
+  int m_count;
+  int64_t m_used_area;
+
+private:
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas& operator=(const TextureAtlas&) = delete;
+};
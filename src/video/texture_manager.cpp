@@ -17,17 +17,23 @@
 #include "video/texture_manager.hpp"
 
 #include <SDL3_image/SDL_image.h>
+#include <algorithm>
 #include <assert.h>
 #include <sstream>
+#include <unordered_set>
 
 #include <physfs.h>
+#include <sexp/value.hpp>
 
 #include "math/rect.hpp"
 #include "physfs/physfs_sdl.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/string_util.hpp"
 #include "video/color.hpp"
 #include "video/gl.hpp"
 #include "video/sampler.hpp"
@@ -75,6 +81,64 @@ GLenum string2filter(const std::string& text)
   }
 }
 
+/** Size of the texture atlas pages, the largest image that is put onto
+    them and the amount of pixels around each image. */
+const int ATLAS_PAGE_SIZE = 1024;
+const int ATLAS_MAX_IMAGE_SIZE = 128;
+const int ATLAS_PADDING = 1;
+
+/** Returns a copy of image with its border pixels repeated around it,
+    so that filtering at the edges of the image doesn't pick up its
+    neighbours on an atlas page. */
+SDLSurfacePtr create_padded_surface(const SDL_Surface& image, int padding)
+{
+  SDL_Surface* src = const_cast<SDL_Surface*>(&image);
+  SDLSurfacePtr padded = SDLSurface::create_rgba(image.w + 2 * padding, image.h + 2 * padding);
+
+  // image may be a cached surface, so its blend mode is restored below.
+  SDL_BlendMode blend_mode = SDL_BLENDMODE_BLEND;
+  SDL_GetSurfaceBlendMode(src, &blend_mode);
+  SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+
+  SDL_Rect dstrect{padding, padding, image.w, image.h};
+  SDL_BlitSurface(src, nullptr, padded.get(), &dstrect);
+
+  for (int i = 0; i < padding; ++i)
+  {
+    const SDL_Rect top{0, 0, image.w, 1};
+    const SDL_Rect bottom{0, image.h - 1, image.w, 1};
+    const SDL_Rect left{0, 0, 1, image.h};
+    const SDL_Rect right{image.w - 1, 0, 1, image.h};
+
+    SDL_Rect top_dst{padding, i, image.w, 1};
+    SDL_Rect bottom_dst{padding, padding + image.h + i, image.w, 1};
+    SDL_Rect left_dst{i, padding, 1, image.h};
+    SDL_Rect right_dst{padding + image.w + i, padding, 1, image.h};
+
+    SDL_BlitSurface(src, &top, padded.get(), &top_dst);
+    SDL_BlitSurface(src, &bottom, padded.get(), &bottom_dst);
+    SDL_BlitSurface(src, &left, padded.get(), &left_dst);
+    SDL_BlitSurface(src, &right, padded.get(), &right_dst);
+  }
+
+  const int corners[4][4] = {
+    { 0, 0, 0, 0 },
+    { image.w - 1, 0, padding + image.w, 0 },
+    { 0, image.h - 1, 0, padding + image.h },
+    { image.w - 1, image.h - 1, padding + image.w, padding + image.h }
+  };
+  for (const auto& corner : corners)
+  {
+    Uint8 r, g, b, a;
+    SDL_ReadSurfacePixel(src, corner[0], corner[1], &r, &g, &b, &a);
+    const SDL_Rect rect{corner[2], corner[3], padding, padding};
+    SDL_FillSurfaceRect(padded.get(), &rect, SDL_MapSurfaceRGBA(padded.get(), r, g, b, a));
+  }
+
+  SDL_SetSurfaceBlendMode(src, blend_mode);
+  return padded;
+}
+
 SDLSurfacePtr create_image_surface(const std::string& filename)
 {
   if (PHYSFS_exists(filename.c_str()))
@@ -86,14 +150,49 @@ SDLSurfacePtr create_image_surface(const std::string& filename)
                                FileSystem::extension(filename));
 }
 
+/** Same as SDLSurface::from_file(), but without logging, as it runs
+    on the decode threads. */
+SDLSurfacePtr decode_image(const std::string& filename)
+{
+  SDL_IOStream* stream = get_physfs_SDLRWops(filename);
+  SDLSurfacePtr surface(IMG_Load_IO(stream, true));
+  if (!surface)
+    throw std::runtime_error("Couldn't load image '" + filename + "': " + SDL_GetError());
+  return surface;
+}
+
+/** Adds the strings in sx that name image files to images. */
+void find_image_files(const sexp::Value& sx, const std::string& basedir, std::vector<std::string>& images)
+{
+  if (sx.is_string())
+  {
+    const std::string& file = sx.as_string();
+    const std::string extension = StringUtil::tolower(FileSystem::extension(file));
+    if (extension == ".png" || extension == ".jpg" || extension == ".jpeg")
+      images.push_back(basedir.empty() ? file : FileSystem::join(basedir, file));
+  }
+  else if (sx.is_array())
+  {
+    const auto& arr = sx.as_array();
+    if (!arr.empty() && arr[0].is_symbol() && arr[0].as_string() == "editor-images")
+      return;
+
+    for (const auto& item : arr)
+      find_image_files(item, basedir, images);
+  }
+}
+
 } // namespace
 
 const std::string TextureManager::s_dummy_texture = "images/engine/missing.png";
 
 TextureManager::TextureManager() :
   m_image_textures(),
-  m_surfaces(),
-  m_load_successful(false)
+  m_surfaces(static_cast<size_t>(std::max(g_config ? g_config->surface_cache_size : 128, 0)) * 1024 * 1024),
+  m_atlas_pages(),
+  m_atlas_entries(),
+  m_load_successful(false),
+  m_decode_pool()
 {
 }
 
@@ -108,6 +207,8 @@ TextureManager::~TextureManager()
   }
   m_image_textures.clear();
   m_surfaces.clear();
+  m_atlas_entries.clear();
+  m_atlas_pages.clear();
 }
 
 TexturePtr
@@ -247,6 +348,128 @@ TextureManager::get(const std::string& _filename,
   return texture;
 }
 
+TexturePtr
+TextureManager::get_packed(const std::string& _filename, const std::optional<Rect>& rect, Rect& region)
+{
+  std::string filename = FileSystem::normalize(_filename);
+  Texture::Key key(filename, rect ? *rect : Rect());
+
+  auto entry = m_atlas_entries.find(key);
+  if (entry != m_atlas_entries.end())
+  {
+    if (TexturePtr page = entry->second.page.lock())
+    {
+      region = entry->second.region;
+      return page;
+    }
+    m_atlas_entries.erase(entry);
+  }
+
+  // Images that are already loaded on their own stay that way.
+  auto i = m_image_textures.find(key);
+  if (i != m_image_textures.end())
+  {
+    if (TexturePtr texture = i->second.lock())
+    {
+      region = Rect(0, 0, texture->get_image_width(), texture->get_image_height());
+      return texture;
+    }
+  }
+
+  m_load_successful = true;
+  TexturePtr texture;
+  try
+  {
+    SDLSurfacePtr image = rect ?
+      create_image_surface_raw(filename, *rect, Sampler()) :
+      take_surface(filename);
+
+    if (image->w <= ATLAS_MAX_IMAGE_SIZE && image->h <= ATLAS_MAX_IMAGE_SIZE)
+    {
+      if (TexturePtr page = pack_image(*image, region))
+      {
+        m_atlas_entries[key] = { page, region };
+        return page;
+      }
+    }
+
+    texture = VideoSystem::current()->new_texture(*image, Sampler());
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't load texture '" << filename << "' (now using dummy texture): " << err.what() << std::endl;
+    m_load_successful = false;
+    texture = create_dummy_texture();
+  }
+
+  texture->m_cache_key = key;
+  m_image_textures[key] = texture;
+
+  region = Rect(0, 0, texture->get_image_width(), texture->get_image_height());
+  return texture;
+}
+
+TexturePtr
+TextureManager::pack_image(const SDL_Surface& image, Rect& region)
+{
+  const Size size(image.w, image.h);
+
+  TexturePtr page;
+  std::optional<Rect> rect;
+  for (auto& atlas_page : m_atlas_pages)
+  {
+    page = atlas_page.texture.lock();
+    if (page && (rect = atlas_page.atlas->insert(size)))
+      break;
+  }
+
+  if (!rect)
+  {
+    prune_atlas();
+
+    SDLSurfacePtr blank = SDLSurface::create_rgba(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+    SDL_FillSurfaceRect(blank.get(), nullptr, 0);
+
+    AtlasPage atlas_page;
+    atlas_page.atlas = std::make_unique<TextureAtlas>(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, ATLAS_PADDING);
+    page = VideoSystem::current()->new_texture(*blank, Sampler());
+    atlas_page.texture = page;
+
+    rect = atlas_page.atlas->insert(size);
+    m_atlas_pages.push_back(std::move(atlas_page));
+  }
+
+  try
+  {
+    SDLSurfacePtr padded = create_padded_surface(image, ATLAS_PADDING);
+    page->update(*padded, rect->left - ATLAS_PADDING, rect->top - ATLAS_PADDING);
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't put image onto texture atlas: " << err.what() << std::endl;
+    return {};
+  }
+
+  region = *rect;
+  return page;
+}
+
+void
+TextureManager::prune_atlas()
+{
+  m_atlas_pages.erase(std::remove_if(m_atlas_pages.begin(), m_atlas_pages.end(),
+                                     [](const AtlasPage& page) { return page.texture.expired(); }),
+                      m_atlas_pages.end());
+
+  for (auto it = m_atlas_entries.begin(); it != m_atlas_entries.end();)
+  {
+    if (it->second.page.expired())
+      it = m_atlas_entries.erase(it);
+    else
+      ++it;
+  }
+}
+
 void
 TextureManager::reap_cache_entry(const Texture::Key& key)
 {
@@ -282,13 +505,41 @@ TextureManager::create_image_texture(const std::string& filename, const Rect& re
 const SDL_Surface&
 TextureManager::get_surface(const std::string& filename)
 {
-  auto i = m_surfaces.find(filename);
-  if (i != m_surfaces.end())
+  if (const SDLSurfacePtr* cached = m_surfaces.get(filename))
   {
-    return *i->second;
+    return **cached;
   }
 
-  SDLSurfacePtr surface = create_image_surface(filename);
+  return cache_surface(filename, create_image_surface(filename));
+}
+
+SDLSurfacePtr
+TextureManager::take_surface(const std::string& filename)
+{
+  if (SDLSurfacePtr* cached = m_surfaces.get(filename))
+  {
+    SDLSurfacePtr surface = std::move(*cached);
+    m_surfaces.erase(filename);
+    return surface;
+  }
+
+  return convert_surface(filename, create_image_surface(filename));
+}
+
+const SDL_Surface&
+TextureManager::cache_surface(const std::string& filename, SDLSurfacePtr surface)
+{
+  surface = convert_surface(filename, std::move(surface));
+
+  // Textures cut from the surface only borrow its pixels while they
+  // are created, so it can be dropped any time after that.
+  const size_t size = static_cast<size_t>(surface->h) * static_cast<size_t>(surface->pitch);
+  return *m_surfaces.put(filename, std::move(surface), size);
+}
+
+SDLSurfacePtr
+TextureManager::convert_surface(const std::string& filename, SDLSurfacePtr surface)
+{
   const SDL_PixelFormatDetails* format = SDL_GetPixelFormatDetails(surface.get()->format);
   if (format->Rmask == 0 &&
       format->Gmask == 0 &&
@@ -300,7 +551,7 @@ TextureManager::get_surface(const std::string& filename)
     surf = SDL_ConvertSurface(const_cast<SDL_Surface*>(surface.get()), SDL_PIXELFORMAT_RGBA8888);
     surface.reset(surf);
   }
-  return *(m_surfaces[filename] = std::move(surface));
+  return surface;
 }
 
 SDLSurfacePtr
@@ -355,7 +606,7 @@ TextureManager::create_image_texture(const std::string& filename, const Sampler&
   m_load_successful = true;
   try
   {
-    SDLSurfacePtr surface = create_image_surface(filename);
+    SDLSurfacePtr surface = take_surface(filename);
     return VideoSystem::current()->new_texture(*surface, sampler);
   }
   catch (const std::exception& err)
@@ -402,21 +653,9 @@ TextureManager::create_dummy_texture() const
 void
 TextureManager::reload()
 {
-  // Reload surfaces
-  for (auto& surface : m_surfaces)
-  {
-    SDLSurfacePtr surface_new;
-    try
-    {
-      surface_new = create_image_surface(surface.first);
-    }
-    catch (const std::exception& err)
-    {
-      log_warning << "Couldn't load texture '" << surface.first << "' (now using dummy texture): " << err.what() << std::endl;
-      surface_new = create_dummy_surface();
-    }
-    surface.second.reset(surface_new);
-  }
+  // Forget the decoded images, they are decoded again from the files
+  // as the textures are reloaded.
+  m_surfaces.clear();
 
   // Reload textures
   for (auto& texture : m_image_textures)
@@ -451,42 +690,168 @@ TextureManager::reload()
 
     texture_ptr->reload(*surface);
   }
+
+  // Reload images on atlas pages, in place
+  for (const auto& entry : m_atlas_entries)
+  {
+    TexturePtr page = entry.second.page.lock();
+    if (!page)
+      continue;
+
+    const std::string& filename = std::get<0>(entry.first);
+    const Rect& rect = std::get<1>(entry.first);
+    const Rect& region = entry.second.region;
+    try
+    {
+      SDLSurfacePtr surface = rect.empty() ?
+        create_image_surface(filename) :
+        create_image_surface_raw(filename, rect, Sampler());
+
+      if (surface->w != region.get_width() || surface->h != region.get_height())
+      {
+        log_warning << "Size of texture '" << filename << "' changed, not reloading it" << std::endl;
+        continue;
+      }
+
+      SDLSurfacePtr padded = create_padded_surface(*surface, ATLAS_PADDING);
+      page->update(*padded, region.left - ATLAS_PADDING, region.top - ATLAS_PADDING);
+    }
+    catch (const std::exception& err)
+    {
+      log_warning << "Couldn't reload texture '" << filename << "': " << err.what() << std::endl;
+    }
+  }
+}
+
+void
+TextureManager::preload(const std::vector<std::string>& filenames)
+{
+  std::vector<std::string> pending;
+  std::unordered_set<std::string> seen;
+  for (const auto& name : filenames)
+  {
+    // Named like get() looks them up.
+    const std::string filename = FileSystem::normalize(name);
+    if (!m_surfaces.contains(filename) && !has_texture(filename) &&
+        seen.insert(filename).second && PHYSFS_exists(filename.c_str()))
+      pending.push_back(filename);
+  }
+
+  std::vector<SDLSurfacePtr> surfaces(pending.size());
+  m_decode_pool.parallel_for(pending.size(), [&pending, &surfaces](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      try
+      {
+        surfaces[i] = decode_image(pending[i]);
+      }
+      catch (const std::exception&)
+      {
+        // Reported once the image is actually requested.
+      }
+    }
+  });
+
+  // Images beyond the cache budget would only push out the first
+  // ones again before they are used, so those are dropped.
+  size_t cost = 0;
+  for (size_t i = 0; i < pending.size(); ++i)
+  {
+    if (!surfaces[i])
+      continue;
+
+    cost += static_cast<size_t>(surfaces[i]->h) * static_cast<size_t>(surfaces[i]->pitch);
+    if (cost > m_surfaces.get_capacity())
+      break;
+
+    cache_surface(pending[i], std::move(surfaces[i]));
+  }
+}
+
+bool
+TextureManager::has_texture(const std::string& filename) const
+{
+  const Texture::Key key(filename, Rect());
+
+  auto i = m_image_textures.find(key);
+  if (i != m_image_textures.end() && !i->second.expired())
+    return true;
+
+  auto entry = m_atlas_entries.find(key);
+  return entry != m_atlas_entries.end() && !entry->second.page.expired();
+}
+
+std::vector<std::string>
+TextureManager::find_images(const sexp::Value& sx, const std::string& basedir)
+{
+  std::vector<std::string> images;
+  find_image_files(sx, basedir, images);
+  return images;
 }
 
 void
 TextureManager::debug_print(std::ostream& out) const
 {
   size_t total_texture_pixels = 0;
+  size_t total_texture_bytes = 0;
   out << "textures:begin" << std::endl;
   for(const auto& it : m_image_textures)
   {
     const auto& key = it.first;
 
-    if (it.second.lock()) {
+    // Textures are uploaded as RGBA, four bytes per pixel.
+    size_t bytes = 0;
+    if (TexturePtr texture = it.second.lock()) {
       total_texture_pixels += std::get<1>(key).get_area();
+      bytes = static_cast<size_t>(texture->get_texture_width()) * static_cast<size_t>(texture->get_texture_height()) * 4;
+      total_texture_bytes += bytes;
     }
 
     out << "  texture "
         << " filename:" << std::get<0>(key) << " " << std::get<1>(key)
-        << " " << "use_count:" << it.second.use_count() << std::endl;
+        << " " << "use_count:" << it.second.use_count()
+        << " bytes:" << bytes << std::endl;
   }
   out << "textures:end" << std::endl;
 
   size_t total_surface_pixels = 0;
   out << "surfaces:begin" << std::endl;
-  for(const auto& it : m_surfaces)
-  {
-    const auto& filename = it.first;
-    const auto& surface = it.second;
-
+  m_surfaces.for_each([&out, &total_surface_pixels](const std::string& filename, const SDLSurfacePtr& surface) {
     total_surface_pixels += surface->w * surface->h;
-    out << "  surface filename:" << filename << " " << surface->w << "x" << surface->h << std::endl;
-  }
+    out << "  surface filename:" << filename << " " << surface->w << "x" << surface->h
+        << " bytes:" << surface->h * surface->pitch << std::endl;
+  });
   out << "surfaces:end" << std::endl;
 
   out << "total texture count:" << m_image_textures.size() << std::endl;
   out << "total texture pixels:" << total_texture_pixels << std::endl;
+  out << "total texture bytes:" << total_texture_bytes << std::endl;
 
   out << "total surface count:" << m_surfaces.size() << std::endl;
   out << "total surface pixels:" << total_surface_pixels << std::endl;
+  out << "total surface bytes:" << m_surfaces.get_cost() << std::endl;
+  out << "surface cache budget:" << m_surfaces.get_capacity() << std::endl;
+  out << "surface cache hits:" << m_surfaces.get_hits()
+      << " misses:" << m_surfaces.get_misses()
+      << " evictions:" << m_surfaces.get_evictions() << std::endl;
+
+  size_t atlas_page_count = 0;
+  int atlas_image_count = 0;
+  out << "atlas:begin" << std::endl;
+  for (const auto& page : m_atlas_pages)
+  {
+    if (page.texture.expired())
+      continue;
+
+    atlas_page_count += 1;
+    atlas_image_count += page.atlas->get_count();
+    out << "  page " << page.atlas->get_width() << "x" << page.atlas->get_height()
+        << " images:" << page.atlas->get_count()
+        << " occupancy:" << page.atlas->get_occupancy()
+        << " use_count:" << page.texture.use_count() << std::endl;
+  }
+  out << "atlas:end" << std::endl;
+
+  out << "total atlas page count:" << atlas_page_count << std::endl;
+  out << "total atlas image count:" << atlas_image_count << std::endl;
 }
@@ -28,15 +28,22 @@
 
 #include "math/rect.hpp"
 #include "util/currenton.hpp"
+#include "util/lru_cache.hpp"
+#include "util/thread_pool.hpp"
 #include "video/sampler.hpp"
 #include "video/sdl_surface_ptr.hpp"
 #include "video/texture.hpp"
+#include "video/texture_atlas.hpp"
 #include "video/texture_ptr.hpp"
 
 class GLTexture;
 class ReaderMapping;
 struct SDL_Surface;
 
+namespace sexp {
+class Value;
+} // namespace sexp
+
 class TextureManager final : public Currenton<TextureManager>
 {
   friend class Texture;
@@ -55,14 +62,52 @@ public:
                  const Sampler& sampler = Sampler());
   TexturePtr create_dummy_texture() const;
 
+  /** Same as get(filename, rect), but images that are small enough are
+      packed into shared atlas pages, so that they can be drawn
+      together. region is set to the area of the image on the returned
+      texture. */
+  TexturePtr get_packed(const std::string& filename, const std::optional<Rect>& rect, Rect& region);
+
   void reload();
 
+  /** Decodes the given images on the decode threads and keeps them in
+      the surface cache, so that textures created from them later only
+      have to be uploaded. Images that are cached already, that have a
+      texture or atlas entry in use, or that don't exist are skipped.
+      Returns once all images are decoded. */
+  void preload(const std::vector<std::string>& filenames);
+
+  /** Returns the image files named by the strings in sx, relative to
+      basedir, e.g. to preload() the images used by a level. Editor
+      images are left out. */
+  static std::vector<std::string> find_images(const sexp::Value& sx, const std::string& basedir = {});
+
   void debug_print(std::ostream& out) const;
 
   inline bool last_load_successful() const { return m_load_successful; }
 
 private:
+  /** Returns the decoded image that textures of parts of it are cut
+      from, the image stays in the surface cache. */
   const SDL_Surface& get_surface(const std::string& filename);
+
+  /** Returns the decoded image for a texture of the whole image. A
+      preloaded image is taken out of the surface cache, others are
+      decoded without being cached, as the texture holds all of it. */
+  SDLSurfacePtr take_surface(const std::string& filename);
+
+  /** Returns true if a texture or atlas entry of the whole image is
+      still in use, so there is no need to decode it again. */
+  bool has_texture(const std::string& filename) const;
+
+  /** Converts surface with convert_surface() and puts it into the
+      surface cache. */
+  const SDL_Surface& cache_surface(const std::string& filename, SDLSurfacePtr surface);
+
+  /** Converts surface to a format that textures can be created from,
+      if needed. */
+  static SDLSurfacePtr convert_surface(const std::string& filename, SDLSurfacePtr surface);
+
   void reap_cache_entry(const Texture::Key& key);
 
   /** on failure a dummy texture is returned and no exception is thrown */
@@ -75,11 +120,42 @@ private:
 
   static SDLSurfacePtr create_dummy_surface();
 
+  /** Puts image onto an atlas page with room for it, or onto a new
+      one, and returns the page. */
+  TexturePtr pack_image(const SDL_Surface& image, Rect& region);
+
+  /** Forgets the atlas pages and entries of textures that are gone. */
+  void prune_atlas();
+
+private:
+  struct AtlasPage
+  {
+    std::weak_ptr<Texture> texture;
+    std::unique_ptr<TextureAtlas> atlas;
+  };
+
+  struct AtlasEntry
+  {
+    std::weak_ptr<Texture> page;
+    Rect region;
+  };
+
 private:
   std::map<Texture::Key, std::weak_ptr<Texture>> m_image_textures;
-  std::unordered_map<std::string, SDLSurfacePtr> m_surfaces;
+
+  /** Decoded images that textures are cut from, keyed by filename,
+      and preloaded images until take_surface() hands them out. Kept
+      within g_config->surface_cache_size, evicted images are decoded
+      again by get_surface() when needed. */
+  LRUCache<std::string, SDLSurfacePtr> m_surfaces;
+  std::vector<AtlasPage> m_atlas_pages;
+  std::map<Texture::Key, AtlasEntry> m_atlas_entries;
   bool m_load_successful;
 
+  /** Decodes images for preload(), all textures are still created on
+      the main thread. */
+  ThreadPool m_decode_pool;
+
 private:
   TextureManager(const TextureManager&) = delete;
   TextureManager& operator=(const TextureManager&) = delete;
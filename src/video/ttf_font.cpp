@@ -23,18 +23,46 @@
 
 #include "util/line_iterator.hpp"
 #include "physfs/physfs_sdl.hpp"
+#include "supertux/debug.hpp"
 #include "util/log.hpp"
+#include "util/utf8_iterator.hpp"
 #include "video/canvas.hpp"
 #include "video/surface.hpp"
 #include "video/ttf_surface_manager.hpp"
 
+namespace {
+
+/** Returns true if the glyphs of codepoint can be placed side by side
+    without shaping, like SDL_ttf does it for Latin, Greek, Cyrillic,
+    CJK and symbols. Scripts that join or reorder their characters
+    are rendered as whole strings. */
+bool is_unshaped(uint32_t codepoint)
+{
+  return codepoint < 0x0590 ||
+         (codepoint >= 0x1E00 && codepoint < 0x2C00) ||
+         (codepoint >= 0x3000 && codepoint < 0xA000) ||
+         (codepoint >= 0xAC00 && codepoint < 0xD7B0) ||
+         (codepoint >= 0xFF00 && codepoint < 0xFFF0);
+}
+
+bool can_use_glyph_atlas(const std::string& line)
+{
+  for (UTF8Iterator it(line); !it.done(); ++it)
+    if (!is_unshaped(*it))
+      return false;
+  return true;
+}
+
+} // namespace
+
 TTFFont::TTFFont(const std::string& filename, int font_size, float line_spacing, int shadow_size, int border) :
   m_font(),
   m_filename(filename),
   m_font_size(font_size),
   m_line_spacing(line_spacing),
   m_shadow_size(shadow_size),
-  m_border(border)
+  m_border(border),
+  m_glyph_batches()
 {
   m_font = TTF_OpenFontIO(get_physfs_SDLRWops(m_filename), 1, font_size);
   if (!m_font)
@@ -47,11 +75,14 @@ TTFFont::TTFFont(const std::string& filename, int font_size, float line_spacing,
 
 TTFFont::~TTFFont()
 {
+  if (TTFSurfaceManager::current())
+    TTFSurfaceManager::current()->get_glyph_atlas().remove_font(*this);
+
   TTF_CloseFont(m_font);
 }
 
 float
-TTFFont::get_text_width(const std::string& text) const
+TTFFont::measure_text_width(const std::string& text) const
 {
   if (text.empty())
     return 0.0f;
@@ -73,7 +104,7 @@ TTFFont::get_text_width(const std::string& text) const
       int h = 0;
       int ret = TTF_GetStringSize(m_font, line.c_str(), line.length(), &w, &h);
       if (ret < 0) {
-        get_logging_instance(false) << "TTFFont::get_text_width(): " << SDL_GetError() << std::endl;
+        get_logging_instance(false) << "TTFFont::measure_text_width(): " << SDL_GetError() << std::endl;
       }
       int const grow = std::max(get_border() * 2, get_shadow_size() * 2);
       line_width = w + grow;
@@ -114,7 +145,27 @@ TTFFont::draw_text(Canvas& canvas, const std::string& text,
   {
     const std::string& line = iter.get();
 
-    if (!line.empty())
+    if (!line.empty() && g_debug.ttf_glyph_atlas && can_use_glyph_atlas(line))
+    {
+      const float width = get_text_width(line);
+
+      Vector new_pos(pos.x, last_y);
+
+      if (alignment == ALIGN_CENTER)
+        new_pos.x -= width / 2.0f;
+      else if (alignment == ALIGN_RIGHT)
+        new_pos.x -= width;
+
+      new_pos = glm::floor(new_pos);
+
+      if (new_pos.x < min_x)
+        min_x = new_pos.x;
+      if (width > max_width)
+        max_width = width;
+
+      draw_glyphs(canvas, line, new_pos, layer, color);
+    }
+    else if (!line.empty())
     {
       TTFSurfacePtr ttf_surface = TTFSurfaceManager::current()->create_surface(*this, line);
       const float width = static_cast<float>(ttf_surface->get_width());
@@ -143,13 +194,79 @@ TTFFont::draw_text(Canvas& canvas, const std::string& text,
   return Rectf(min_x, init_y, min_x + max_width, last_y);
 }
 
+void
+TTFFont::draw_glyphs(Canvas& canvas, const std::string& line,
+                     const Vector& pos, int layer, const Color& color) const
+{
+  TTFGlyphAtlas& atlas = TTFSurfaceManager::current()->get_glyph_atlas();
+
+  // The batches keep their memory from line to line, the Canvas copies
+  // the rectangles.
+  std::vector<GlyphBatch>& batches = m_glyph_batches;
+  for (auto& batch : batches)
+  {
+    batch.decoration_srcrects.clear();
+    batch.decoration_dstrects.clear();
+    batch.core_srcrects.clear();
+    batch.core_dstrects.clear();
+  }
+
+  float pen_x = pos.x;
+  uint32_t previous = 0;
+  for (UTF8Iterator it(line); !it.done(); ++it)
+  {
+    const uint32_t codepoint = *it;
+    if (codepoint == 0)
+      continue;
+
+    int kerning = 0;
+    if (previous != 0 && TTF_GetGlyphKerning(m_font, previous, codepoint, &kerning))
+      pen_x += static_cast<float>(kerning);
+    previous = codepoint;
+
+    const TTFGlyphAtlas::Glyph& glyph = atlas.get_glyph(*this, codepoint);
+    if (glyph.page >= 0)
+    {
+      if (static_cast<int>(batches.size()) <= glyph.page)
+        batches.resize(glyph.page + 1);
+      GlyphBatch& batch = batches[glyph.page];
+
+      const Vector glyph_pos(pen_x + glyph.offset, pos.y);
+      batch.core_srcrects.push_back(glyph.core);
+      batch.core_dstrects.emplace_back(glyph_pos, glyph.core.get_size());
+      if (glyph.decoration.get_width() > 0.0f)
+      {
+        batch.decoration_srcrects.push_back(glyph.decoration);
+        batch.decoration_dstrects.emplace_back(glyph_pos, glyph.decoration.get_size());
+      }
+    }
+
+    pen_x += glyph.advance;
+  }
+
+  for (size_t page = 0; page < batches.size(); ++page)
+  {
+    const GlyphBatch& batch = batches[page];
+    if (!batch.decoration_srcrects.empty())
+      canvas.draw_surface_batch(atlas.get_page(static_cast<int>(page)),
+                                batch.decoration_srcrects, batch.decoration_dstrects, color, layer);
+  }
+  for (size_t page = 0; page < batches.size(); ++page)
+  {
+    const GlyphBatch& batch = batches[page];
+    if (!batch.core_srcrects.empty())
+      canvas.draw_surface_batch(atlas.get_page(static_cast<int>(page)),
+                                batch.core_srcrects, batch.core_dstrects, color, layer);
+  }
+}
+
 std::string
-TTFFont::wrap_to_width(const std::string& text, float width, std::string* overflow)
+TTFFont::wrap_text_to_width(const std::string& text, float width, std::string* overflow)
 {
   std::string s = text;
 
   // if text is already smaller, return full text
-  if (get_text_width(s) <= width) {
+  if (measure_text_width(s) <= width) {
     if (overflow) *overflow = "";
     return s;
   }
@@ -158,7 +275,7 @@ TTFFont::wrap_to_width(const std::string& text, float width, std::string* overfl
   for (int i = static_cast<int>(s.length()) - 1; i >= 0; i--) {
     std::string s2 = s.substr(0,i);
     if (s[i] != ' ') continue;
-    if (get_text_width(s2) <= width) {
+    if (measure_text_width(s2) <= width) {
       if (overflow) *overflow = s.substr(i+1);
       return s.substr(0, i);
     }
@@ -180,7 +297,7 @@ TTFFont::wrap_to_width(const std::string& text, float width, std::string* overfl
     // check whether text now goes over allowed width, and if so
     // return everything up to the character and put the rest in the overflow
     std::string s2 = s.substr(0,i+char_bytes);
-    if (get_text_width(s2) > width) {
+    if (measure_text_width(s2) > width) {
       if (i == 0) i += char_bytes; // edge case when even one char is too wide
       if (overflow) *overflow = s.substr(i);
       return s.substr(0, i);
@@ -18,8 +18,10 @@
 #pragma once
 
 #include <SDL3_ttf/SDL_ttf.h>
+#include <vector>
 
 #include "math/fwd.hpp"
+#include "math/rectf.hpp"
 #include "video/color.hpp"
 #include "video/font.hpp"
 
@@ -40,11 +42,8 @@ public:
     return static_cast<float>(m_font_size) * m_line_spacing;
   }
 
-  virtual float get_text_width(const std::string& text) const override;
   virtual float get_text_height(const std::string& text) const override;
 
-  virtual std::string wrap_to_width(const std::string& text, float width, std::string* overflow) override;
-
   virtual Rectf draw_text(Canvas& canvas, const std::string& text,
                           const Vector& pos, FontAlignment alignment, int layer, const Color& color) override;
 
@@ -53,6 +52,28 @@ public:
 
   inline TTF_Font* get_ttf_font() const { return m_font; }
 
+protected:
+  virtual float measure_text_width(const std::string& text) const override;
+  virtual std::string wrap_text_to_width(const std::string& text, float width, std::string* overflow) override;
+
+private:
+  /** Draws a single line of text glyph by glyph from the
+      TTFGlyphAtlas. */
+  void draw_glyphs(Canvas& canvas, const std::string& line,
+                   const Vector& pos, int layer, const Color& color) const;
+
+private:
+  /** Rectangles of the glyphs of a line that are on the same page. The
+      decorations of all glyphs are drawn before their cores, the same
+      way TTFSurface blits them. */
+  struct GlyphBatch
+  {
+    std::vector<Rectf> decoration_srcrects;
+    std::vector<Rectf> decoration_dstrects;
+    std::vector<Rectf> core_srcrects;
+    std::vector<Rectf> core_dstrects;
+  };
+
 private:
   TTF_Font* m_font;
   std::string m_filename;
@@ -61,6 +82,9 @@ private:
   int m_shadow_size;
   int m_border;
 
+  /** Scratch space of draw_glyphs(), one batch per page */
+  mutable std::vector<GlyphBatch> m_glyph_batches;
+
 private:
   TTFFont(const TTFFont&) = delete;
   TTFFont& operator=(const TTFFont&) = delete;
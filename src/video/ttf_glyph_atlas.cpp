@@ -0,0 +1,210 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/ttf_glyph_atlas.hpp"
+
+#include <SDL3_ttf/SDL_ttf.h>
+#include <algorithm>
+#include <optional>
+#include <ostream>
+
+#include "util/log.hpp"
+#include "video/sdl_surface.hpp"
+#include "video/surface.hpp"
+#include "video/texture.hpp"
+#include "video/ttf_font.hpp"
+#include "video/ttf_surface.hpp"
+#include "video/video_system.hpp"
+
+namespace {
+
+/** Size of the glyph pages and the amount of pixels around each
+    glyph */
+const int PAGE_SIZE = 512;
+const int PADDING = 1;
+
+SDLSurfacePtr create_blank_page()
+{
+  SDLSurfacePtr blank = SDLSurface::create_rgba(PAGE_SIZE, PAGE_SIZE);
+  SDL_FillSurfaceRect(blank.get(), nullptr, 0);
+  return blank;
+}
+
+} // namespace
+
+TTFGlyphAtlas::TTFGlyphAtlas() :
+  m_pages(),
+  m_current(-1),
+  m_glyphs()
+{
+}
+
+const TTFGlyphAtlas::Glyph&
+TTFGlyphAtlas::get_glyph(const TTFFont& font, uint32_t codepoint)
+{
+  const Key key(font.get_ttf_font(), codepoint);
+  auto it = m_glyphs.find(key);
+  if (it == m_glyphs.end())
+    it = m_glyphs.emplace(key, create_glyph(font, codepoint)).first;
+  return it->second;
+}
+
+TTFGlyphAtlas::Glyph
+TTFGlyphAtlas::create_glyph(const TTFFont& font, uint32_t codepoint)
+{
+  Glyph glyph{ -1, Rectf(), Rectf(), 0.0f, 0.0f };
+
+  int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
+  if (!TTF_GetGlyphMetrics(font.get_ttf_font(), codepoint, &minx, &maxx, &miny, &maxy, &advance))
+  {
+    log_debug << "Couldn't get metrics of glyph " << codepoint << ": " << SDL_GetError() << std::endl;
+    return glyph;
+  }
+
+  // Like a string, the glyph image starts left of the pen position
+  // when the glyph reaches to the left of it.
+  glyph.offset = static_cast<float>(std::min(minx, 0));
+  glyph.advance = static_cast<float>(advance);
+
+  SDLSurfacePtr core(TTF_RenderGlyph_Blended(font.get_ttf_font(), codepoint, SDL_Color{255, 255, 255, 255}));
+  if (!core || core->w <= 0 || core->h <= 0 || maxx <= minx)
+    return glyph;
+
+  SDLSurfacePtr decoration;
+  if (font.get_shadow_size() > 0 || font.get_border() > 0)
+  {
+    const int grow = std::max(font.get_border() * 2, font.get_shadow_size() * 2);
+    decoration = SDLSurface::create_rgba(core->w + grow, core->h + grow);
+    TTFSurface::render_decoration(font, *core, *decoration);
+  }
+
+  // render_decoration() tints the glyph black, uploading it would keep
+  // the tint.
+  SDL_SetSurfaceAlphaMod(core.get(), 255);
+  SDL_SetSurfaceColorMod(core.get(), 255, 255, 255);
+
+  insert(*core, decoration.get(), glyph);
+  return glyph;
+}
+
+void
+TTFGlyphAtlas::insert(const SDL_Surface& core, const SDL_Surface* decoration, Glyph& glyph)
+{
+  const Size core_size(core.w, core.h);
+  const Size decoration_size = decoration ? Size(decoration->w, decoration->h) : Size();
+
+  // Both parts of a glyph are drawn from the same page, so they are
+  // put onto a new page together when the last one is full.
+  auto insert_into = [&](Page& page, std::optional<Rect>& core_rect, std::optional<Rect>& decoration_rect) {
+    core_rect = page.atlas->insert(core_size);
+    if (core_rect && decoration)
+      decoration_rect = page.atlas->insert(decoration_size);
+    return core_rect && (!decoration || decoration_rect);
+  };
+
+  std::optional<Rect> core_rect;
+  std::optional<Rect> decoration_rect;
+  if (m_current < 0 || !insert_into(m_pages[m_current], core_rect, decoration_rect))
+  {
+    // Pages of removed fonts are filled again before a new one is made.
+    auto empty = std::find_if(m_pages.begin(), m_pages.end(),
+                              [](const Page& page) { return page.glyphs == 0; });
+    if (empty != m_pages.end() && empty->needs_clear)
+    {
+      empty->texture->update(*create_blank_page(), 0, 0);
+      empty->needs_clear = false;
+    }
+
+    if (empty != m_pages.end() && insert_into(*empty, core_rect, decoration_rect))
+    {
+      m_current = static_cast<int>(empty - m_pages.begin());
+    }
+    else
+    {
+      Page page;
+      page.atlas = std::make_unique<TextureAtlas>(PAGE_SIZE, PAGE_SIZE, PADDING);
+      page.texture = VideoSystem::current()->new_texture(*create_blank_page(), Sampler());
+      page.surface = Surface::from_texture(page.texture);
+      page.glyphs = 0;
+      page.needs_clear = false;
+
+      if (!insert_into(page, core_rect, decoration_rect))
+      {
+        log_warning << "Glyph of " << core.w << "x" << core.h << " doesn't fit onto a glyph page" << std::endl;
+        return;
+      }
+
+      m_pages.push_back(std::move(page));
+      m_current = static_cast<int>(m_pages.size()) - 1;
+    }
+  }
+
+  // Pages are cleared to transparent, so the padding needs no filling,
+  // glyphs fade out at their border anyway.
+  Page& page = m_pages[m_current];
+  page.texture->update(core, core_rect->left, core_rect->top);
+  glyph.core = Rectf(*core_rect);
+  if (decoration)
+  {
+    page.texture->update(*decoration, decoration_rect->left, decoration_rect->top);
+    glyph.decoration = Rectf(*decoration_rect);
+  }
+  page.glyphs += 1;
+  glyph.page = m_current;
+}
+
+void
+TTFGlyphAtlas::remove_font(const TTFFont& font)
+{
+  void* ttf_font = font.get_ttf_font();
+  auto begin = m_glyphs.lower_bound(Key(ttf_font, 0));
+  auto end = m_glyphs.upper_bound(Key(ttf_font, UINT32_MAX));
+
+  for (auto it = begin; it != end; ++it)
+  {
+    if (it->second.page < 0)
+      continue;
+
+    Page& page = m_pages[it->second.page];
+    page.glyphs -= 1;
+    if (page.glyphs == 0)
+    {
+      page.atlas = std::make_unique<TextureAtlas>(PAGE_SIZE, PAGE_SIZE, PADDING);
+      page.needs_clear = true;
+      if (it->second.page == m_current)
+        m_current = -1;
+    }
+  }
+
+  m_glyphs.erase(begin, end);
+}
+
+void
+TTFGlyphAtlas::clear()
+{
+  m_glyphs.clear();
+  m_pages.clear();
+  m_current = -1;
+}
+
+void
+TTFGlyphAtlas::print_debug_info(std::ostream& out) const
+{
+  const auto unused = std::count_if(m_pages.begin(), m_pages.end(),
+                                    [](const Page& page) { return page.glyphs == 0; });
+  out << "TTFGlyphAtlas.glyphs: " << m_glyphs.size()
+      << "  pages: " << m_pages.size() << "  unused: " << unused << "  " << m_pages.size() * PAGE_SIZE * PAGE_SIZE * 4 / 1000 << "KB" << std::endl;
+}
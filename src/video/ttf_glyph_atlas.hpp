@@ -0,0 +1,118 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <tuple>
+#include <vector>
+
+#include "math/rectf.hpp"
+#include "video/surface_ptr.hpp"
+#include "video/texture_atlas.hpp"
+#include "video/texture_ptr.hpp"
+
+struct SDL_Surface;
+class TTFFont;
+
+/**
+ * Rasterizes the glyphs of TTFFonts once onto shared atlas pages, so
+ * that text can be drawn as a batch of quads. New strings then only
+ * cost texture uploads for glyphs that weren't used before, and the
+ * memory used grows with the set of glyphs instead of with the amount
+ * of different strings.
+ */
+class TTFGlyphAtlas final
+{
+public:
+  struct Glyph
+  {
+    /** Index of the page the glyph is on, -1 for glyphs without
+        pixels, like spaces */
+    int page;
+
+    /** The white glyph on the page */
+    Rectf core;
+
+    /** Shadow and outline of the glyph on the page, empty if the font
+        has neither. Its top left corner lines up with the core. */
+    Rectf decoration;
+
+    /** Horizontal distance from the pen position to the left of the
+        glyph image */
+    float offset;
+
+    float advance;
+  };
+
+public:
+  TTFGlyphAtlas();
+
+  /** Returns the glyph of the given codepoint, rasterizing it if it
+      isn't on a page yet. */
+  const Glyph& get_glyph(const TTFFont& font, uint32_t codepoint);
+
+  inline const SurfacePtr& get_page(int page) const { return m_pages[page].surface; }
+  inline int get_page_count() const { return static_cast<int>(m_pages.size()); }
+
+  /** Forgets the glyphs of font, called when the font goes away, as
+      another font could take its place in memory. Pages without any
+      glyphs left are filled again before new pages are made. */
+  void remove_font(const TTFFont& font);
+
+  void clear();
+
+  void print_debug_info(std::ostream& out) const;
+
+private:
+  struct Page
+  {
+    TexturePtr texture;
+    SurfacePtr surface;
+    std::unique_ptr<TextureAtlas> atlas;
+
+    /** Glyphs with pixels on the page */
+    int glyphs;
+
+    /** Set when all glyphs were removed, the old pixels are only
+        cleared once the page is used again, text drawn with them
+        earlier in the frame still needs them. */
+    bool needs_clear;
+  };
+
+private:
+  Glyph create_glyph(const TTFFont& font, uint32_t codepoint);
+
+  /** Puts the images of a glyph onto a page and stores where they
+      ended up in glyph. decoration may be null. */
+  void insert(const SDL_Surface& core, const SDL_Surface* decoration, Glyph& glyph);
+
+private:
+  std::vector<Page> m_pages;
+
+  /** Index of the page new glyphs are put onto, -1 if there is none */
+  int m_current;
+
+  using Key = std::tuple<void*, uint32_t>;
+  std::map<Key, Glyph> m_glyphs;
+
+private:
+  TTFGlyphAtlas(const TTFGlyphAtlas&) = delete;
+  TTFGlyphAtlas& operator=(const TTFGlyphAtlas&) = delete;
+};
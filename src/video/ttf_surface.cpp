@@ -44,11 +44,30 @@ TTFSurface::create(const TTFFont& font, const std::string& text)
 
   SDLSurfacePtr target = SDLSurface::create_rgba(text_surface->w + grow, text_surface->h + grow);
 
-  { // shadow
-    SDL_SetSurfaceAlphaMod(text_surface.get(), 192);
-    SDL_SetSurfaceColorMod(text_surface.get(), 0, 0, 0);
+  render_decoration(font, *text_surface, *target);
+
+  { // white core
+    SDL_SetSurfaceAlphaMod(text_surface.get(), 255);
+    SDL_SetSurfaceColorMod(text_surface.get(), 255, 255, 255);
     SDL_SetSurfaceBlendMode(text_surface.get(), SDL_BLENDMODE_BLEND);
 
+    SDL_Rect dstrect{0, 0, text_surface->w, text_surface->h};
+
+    SDL_BlitSurface(text_surface.get(), nullptr, target.get(), &dstrect);
+  }
+
+  SurfacePtr result = Surface::from_texture(VideoSystem::current()->new_texture(*target));
+  return std::make_shared<TTFSurface>(result, Vector(0, 0));
+}
+
+void
+TTFSurface::render_decoration(const TTFFont& font, SDL_Surface& text_surface, SDL_Surface& target)
+{
+  { // shadow
+    SDL_SetSurfaceAlphaMod(&text_surface, 192);
+    SDL_SetSurfaceColorMod(&text_surface, 0, 0, 0);
+    SDL_SetSurfaceBlendMode(&text_surface, SDL_BLENDMODE_BLEND);
+
     using P = std::tuple<int, int>;
     const std::initializer_list<std::tuple<int, int> > positions[] = {
       {},
@@ -61,16 +80,16 @@ TTFSurface::create(const TTFFont& font, const std::string& text)
     int shadow_size = std::min(2, font.get_shadow_size());
     for (const auto& p : positions[shadow_size])
     {
-      SDL_Rect dstrect{std::get<0>(p) + 2, std::get<1>(p) + 2, text_surface->w, text_surface->h};
-      SDL_BlitSurface(text_surface.get(), nullptr,
-                      target.get(), &dstrect);
+      SDL_Rect dstrect{std::get<0>(p) + 2, std::get<1>(p) + 2, text_surface.w, text_surface.h};
+      SDL_BlitSurface(&text_surface, nullptr,
+                      &target, &dstrect);
     }
   }
 
   { // outline
-    SDL_SetSurfaceAlphaMod(text_surface.get(), 255);
-    SDL_SetSurfaceColorMod(text_surface.get(), 0, 0, 0);
-    SDL_SetSurfaceBlendMode(text_surface.get(), SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(&text_surface, 255);
+    SDL_SetSurfaceColorMod(&text_surface, 0, 0, 0);
+    SDL_SetSurfaceBlendMode(&text_surface, SDL_BLENDMODE_BLEND);
 
     using P = std::tuple<int, int>;
     const std::initializer_list<std::tuple<int, int> > positions[] = {
@@ -83,24 +102,11 @@ TTFSurface::create(const TTFFont& font, const std::string& text)
     int border = std::min(2, font.get_border());
     for (const auto& p : positions[border])
     {
-      SDL_Rect dstrect{std::get<0>(p), std::get<1>(p), text_surface->w, text_surface->h};
-      SDL_BlitSurface(text_surface.get(), nullptr,
-                      target.get(), &dstrect);
+      SDL_Rect dstrect{std::get<0>(p), std::get<1>(p), text_surface.w, text_surface.h};
+      SDL_BlitSurface(&text_surface, nullptr,
+                      &target, &dstrect);
     }
   }
-
-  { // white core
-    SDL_SetSurfaceAlphaMod(text_surface.get(), 255);
-    SDL_SetSurfaceColorMod(text_surface.get(), 255, 255, 255);
-    SDL_SetSurfaceBlendMode(text_surface.get(), SDL_BLENDMODE_BLEND);
-
-    SDL_Rect dstrect{0, 0, text_surface->w, text_surface->h};
-
-    SDL_BlitSurface(text_surface.get(), nullptr, target.get(), &dstrect);
-  }
-
-  SurfacePtr result = Surface::from_texture(VideoSystem::current()->new_texture(*target));
-  return std::make_shared<TTFSurface>(result, Vector(0, 0));
 }
 
 TTFSurface::TTFSurface(const SurfacePtr& surface, const Vector& offset) :
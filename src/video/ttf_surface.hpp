@@ -22,6 +22,7 @@
 #include "math/vector.hpp"
 #include "video/surface_ptr.hpp"
 
+struct SDL_Surface;
 class TTFFont;
 class TTFSurface;
 
@@ -33,6 +34,11 @@ class TTFSurface final
 public:
   static TTFSurfacePtr create(const TTFFont& font, const std::string& text);
 
+  /** Blits the shadow and the outline of the font for text_surface
+      onto target, which has to be larger than text_surface by the
+      amount the font grows text. The white text itself is left out. */
+  static void render_decoration(const TTFFont& font, SDL_Surface& text_surface, SDL_Surface& target);
+
 public:
   TTFSurface(const SurfacePtr& surface, const Vector& offset);
 
@@ -36,7 +36,8 @@ TTFSurfaceManager::CacheEntry::CacheEntry(const TTFSurfacePtr& s) :
 
 TTFSurfaceManager::TTFSurfaceManager() :
   m_cache(),
-  m_cache_iter(m_cache.end())
+  m_cache_iter(m_cache.end()),
+  m_glyph_atlas()
 {
 }
 
@@ -88,6 +89,7 @@ TTFSurfaceManager::clear_cache()
 {
   m_cache.clear();
   m_cache_iter = m_cache.begin();
+  m_glyph_atlas.clear();
 }
 
 void
@@ -120,4 +122,5 @@ TTFSurfaceManager::print_debug_info(std::ostream& out)
     return accumulator + entry.second.ttf_surface->get_width() * entry.second.ttf_surface->get_height() * 4;
   });
   out << "TTFSurfaceManager.cache_size: " << m_cache.size() << "  " << cache_bytes / 1000 << "KB" << std::endl;
+  m_glyph_atlas.print_debug_info(out);
 }
@@ -24,6 +24,7 @@
 #include "util/currenton.hpp"
 #include "video/color.hpp"
 #include "video/surface_ptr.hpp"
+#include "video/ttf_glyph_atlas.hpp"
 #include "video/ttf_surface.hpp"
 
 class TTFFont;
@@ -38,6 +39,8 @@ public:
   // Returns -1 if there is no cached text surface
   int get_cached_surface_width(const TTFFont& font, const std::string& text);
 
+  inline TTFGlyphAtlas& get_glyph_atlas() { return m_glyph_atlas; }
+
   void clear_cache();
 
   void print_debug_info(std::ostream& out);
@@ -61,6 +64,8 @@ private:
 
   std::map<Key, CacheEntry>::iterator m_cache_iter;
 
+  TTFGlyphAtlas m_glyph_atlas;
+
 private:
   TTFSurfaceManager(const TTFSurfaceManager&) = delete;
   TTFSurfaceManager& operator=(const TTFSurfaceManager&) = delete;
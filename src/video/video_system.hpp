@@ -68,6 +68,10 @@ public:
   virtual Renderer& get_renderer() const = 0;
   virtual Renderer& get_lightmap() const = 0;
 
+  /** Renderer for the cached static lights, with the resolution of the
+      lightmap and twice the size of the screen in each direction. */
+  virtual Renderer& get_static_lightmap() const = 0;
+
   virtual TexturePtr new_texture(const SDL_Surface& image, const Sampler& sampler = Sampler()) = 0;
 
   virtual const Viewport& get_viewport() const = 0;
@@ -57,10 +57,10 @@ void
 WorldMapObject::initialize()
 {
   // Set sector position from provided tile position
-  m_col.m_bbox.set_pos(Vector(32.0f * m_col.m_bbox.get_left() +
-                    (m_col.m_bbox.get_width() < 32.f ? (32.f - m_col.m_bbox.get_width()) / 2 : 0),
-                       32.0f * m_col.m_bbox.get_top() +
-                    (m_col.m_bbox.get_height() < 32.f ? (32.f - m_col.m_bbox.get_height()) / 2 : 0)));
+  m_col.set_pos(Vector(32.0f * m_col.get_bbox().get_left() +
+                    (m_col.get_bbox().get_width() < 32.f ? (32.f - m_col.get_bbox().get_width()) / 2 : 0),
+                       32.0f * m_col.get_bbox().get_top() +
+                    (m_col.get_bbox().get_height() < 32.f ? (32.f - m_col.get_bbox().get_height()) / 2 : 0)));
   update_pos();
 }
 
@@ -99,8 +99,8 @@ WorldMapObject::draw_normal(DrawingContext& context)
   if (!m_sprite) return;
 
   m_sprite->draw(context.color(),
-                 m_col.m_bbox.p1() + Vector((m_col.m_bbox.get_width() < 32.f ? (32.f - m_col.m_bbox.get_width()) / 2 : 0),
-                                            (m_col.m_bbox.get_height() < 32.f ? (32.f - m_col.m_bbox.get_height()) / 2 : 0)),
+                 m_col.get_bbox().p1() + Vector((m_col.get_bbox().get_width() < 32.f ? (32.f - m_col.get_bbox().get_width()) / 2 : 0),
+                                            (m_col.get_bbox().get_height() < 32.f ? (32.f - m_col.get_bbox().get_height()) / 2 : 0)),
                  m_layer);
 }
 
@@ -110,27 +110,27 @@ WorldMapObject::after_editor_set()
   MovingSprite::after_editor_set();
 
   // Set sector position from provided tile position
-  m_col.m_bbox.set_pos(Vector(32.0f * m_tile_x +
-                    (m_col.m_bbox.get_width() < 32.f ? (32.f - m_col.m_bbox.get_width()) / 2 : 0),
+  m_col.set_pos(Vector(32.0f * m_tile_x +
+                    (m_col.get_bbox().get_width() < 32.f ? (32.f - m_col.get_bbox().get_width()) / 2 : 0),
                        32.0f * m_tile_y +
-                    (m_col.m_bbox.get_height() < 32.f ? (32.f - m_col.m_bbox.get_height()) / 2 : 0)));
+                    (m_col.get_bbox().get_height() < 32.f ? (32.f - m_col.get_bbox().get_height()) / 2 : 0)));
 }
 
 void
 WorldMapObject::update_pos()
 {
-  m_tile_x = static_cast<int>(m_col.m_bbox.get_left()) / 32;
-  m_tile_y = static_cast<int>(m_col.m_bbox.get_top()) / 32;
+  m_tile_x = static_cast<int>(m_col.get_bbox().get_left()) / 32;
+  m_tile_y = static_cast<int>(m_col.get_bbox().get_top()) / 32;
 }
 
 void
 WorldMapObject::update_pos(const Vector& pos)
 {
   // Set sector position to the provided position, rounding it to be divisible by 32
-  m_col.m_bbox.set_pos(Vector(32.0f * static_cast<int>(pos.x / 32) +
-                    (m_col.m_bbox.get_width() < 32.f ? (32.f - m_col.m_bbox.get_width()) / 2 : 0),
+  m_col.set_pos(Vector(32.0f * static_cast<int>(pos.x / 32) +
+                    (m_col.get_bbox().get_width() < 32.f ? (32.f - m_col.get_bbox().get_width()) / 2 : 0),
                        32.0f * static_cast<int>(pos.y / 32) +
-                    (m_col.m_bbox.get_height() < 32.f ? (32.f - m_col.m_bbox.get_height()) / 2 : 0)));
+                    (m_col.get_bbox().get_height() < 32.f ? (32.f - m_col.get_bbox().get_height()) / 2 : 0)));
   update_pos();
 }
 
@@ -149,8 +149,8 @@ WorldMapObject::move_to(const Vector& pos)
 void
 WorldMapObject::move(const Vector& dist)
 {
-  m_col.m_bbox.move(dist);
-  update_pos(m_col.m_bbox.p1());
+  m_col.move(dist);
+  update_pos(m_col.get_bbox().p1());
 }
 
 } // namespace worldmap
@@ -0,0 +1,239 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "collision/collision_arrays.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "collision/collision_grid.hpp"
+#include "collision/collision_group.hpp"
+
+namespace {
+
+const int OBJECT_COUNT = 2000;
+const float MAX_SPEED = 16.0f;
+const float EPSILON = 0.002f;
+
+const uint8_t MOVING_GROUPS = (1 << COLGROUP_MOVING) | (1 << COLGROUP_MOVING_STATIC);
+const uint8_t STATIC_GROUPS = (1 << COLGROUP_STATIC) | (1 << COLGROUP_MOVING_STATIC);
+
+/** An object as the passes of CollisionSystem::update() used to see
+    it: the collision state sits inside of a large game object, which
+    is allocated on its own. */
+struct Object
+{
+  Rectf bbox;
+  Rectf dest;
+  Vector movement;
+  uint8_t group;
+  bool valid;
+  char payload[1024];
+};
+
+struct Spawn
+{
+  Rectf bbox;
+  uint8_t group;
+};
+
+/** Objects spread over a crowded level, about a quarter of them
+    static, like enemies between platforms and bonus blocks. */
+std::vector<Spawn> make_spawns(std::mt19937& rng)
+{
+  std::uniform_real_distribution<float> x(0.0f, 4000.0f);
+  std::uniform_real_distribution<float> y(0.0f, 1000.0f);
+  std::uniform_int_distribution<int> group(0, 7);
+
+  std::vector<Spawn> spawns;
+  for (int i = 0; i < OBJECT_COUNT; ++i)
+  {
+    const float left = x(rng);
+    const float top = y(rng);
+    const int g = group(rng);
+    const uint8_t colgroup = static_cast<uint8_t>(g < 2 ? COLGROUP_STATIC :
+                                                  g < 3 ? COLGROUP_MOVING_STATIC :
+                                                  g < 4 ? COLGROUP_TOUCHABLE : COLGROUP_MOVING);
+    spawns.push_back({ Rectf(left, top, left + 32.0f, top + 32.0f), colgroup });
+  }
+  return spawns;
+}
+
+Vector get_movement(int step, size_t i, uint8_t group)
+{
+  if (group == COLGROUP_STATIC || group == COLGROUP_TOUCHABLE)
+    return Vector(0.0f, 0.0f);
+
+  const float phase = static_cast<float>(step) * 0.05f + static_cast<float>(i);
+  return Vector(std::sin(phase) * 3.0f, std::cos(phase) * 3.0f);
+}
+
+void fill_grid(CollisionGrid& grid, const std::vector<Rectf>& rects)
+{
+  grid.reset(Rectf(-100.0f, -100.0f, 4100.0f, 1100.0f));
+  for (uint32_t i = 0; i < static_cast<uint32_t>(rects.size()); ++i)
+    grid.insert(i, rects[i]);
+}
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int step_count = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 1000;
+
+  std::mt19937 rng(1);
+  const std::vector<Spawn> spawns = make_spawns(rng);
+
+  // Allocate the objects in a random order, like objects spawned while
+  // a level is played.
+  std::vector<size_t> order(spawns.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::shuffle(order.begin(), order.end(), rng);
+
+  std::vector<std::unique_ptr<Object>> storage(spawns.size());
+  for (const size_t i : order)
+  {
+    storage[i] = std::make_unique<Object>();
+    storage[i]->bbox = spawns[i].bbox;
+    storage[i]->group = spawns[i].group;
+    storage[i]->valid = true;
+  }
+  std::vector<Object*> objects;
+  for (const auto& object : storage)
+    objects.push_back(object.get());
+
+  // The passes read the state through the object pointers.
+  long checksum_objects = 0;
+  CollisionGrid grid;
+  std::vector<Rectf> grid_rects(objects.size());
+  std::vector<uint32_t> candidates;
+  auto start = Clock::now();
+  for (int step = 0; step < step_count; ++step)
+  {
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+      Object& object = *objects[i];
+      object.movement = get_movement(step, i, object.group);
+      if (glm::length(object.movement) > MAX_SPEED)
+        object.movement = glm::normalize(object.movement) * MAX_SPEED;
+      object.dest = object.bbox;
+      object.dest.move(object.movement);
+      grid_rects[i] = object.dest;
+    }
+    fill_grid(grid, grid_rects);
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(objects.size()); ++i)
+    {
+      const Object& object = *objects[i];
+      if (!((1 << object.group) & MOVING_GROUPS) || !object.valid)
+        continue;
+
+      grid.query(object.dest, candidates);
+      for (const uint32_t index : candidates)
+      {
+        const Object& other = *objects[index];
+        if (index == i || !((1 << other.group) & STATIC_GROUPS) || !other.valid)
+          continue;
+        if (object.dest.overlaps(other.dest.grown(EPSILON)))
+          checksum_objects += 1;
+      }
+
+      for (auto it = std::upper_bound(candidates.begin(), candidates.end(), i); it != candidates.end(); ++it)
+      {
+        const Object& other = *objects[*it];
+        if (!((1 << other.group) & MOVING_GROUPS) || !other.valid)
+          continue;
+        if (object.dest.overlaps(other.dest))
+          checksum_objects += 1000;
+      }
+    }
+
+    for (Object* object : objects)
+    {
+      object->bbox = object->dest;
+      object->movement = Vector(0.0f, 0.0f);
+    }
+  }
+  const double objects_ms = elapsed_ms(start);
+
+  // The same passes on CollisionArrays.
+  long checksum_arrays = 0;
+  CollisionArrays arrays;
+  for (const auto& spawn : spawns)
+    arrays.add(spawn.group, spawn.bbox, Vector(0.0f, 0.0f));
+  start = Clock::now();
+  for (int step = 0; step < step_count; ++step)
+  {
+    for (uint32_t i = 0; i < static_cast<uint32_t>(arrays.size()); ++i)
+      arrays.set_movement(i, get_movement(step, i, arrays.get_group(i)));
+    arrays.begin_update(MAX_SPEED);
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(arrays.size()); ++i)
+    {
+      if (!arrays.is_selected(i, MOVING_GROUPS))
+        continue;
+
+      const Rectf& dest = arrays.get_dest(i);
+      arrays.get_grid().query(dest, candidates);
+      for (const uint32_t index : candidates)
+      {
+        if (index == i || !arrays.is_selected(index, STATIC_GROUPS))
+          continue;
+        if (dest.overlaps(arrays.get_dest(index).grown(EPSILON)))
+          checksum_arrays += 1;
+      }
+
+      for (auto it = std::upper_bound(candidates.begin(), candidates.end(), i); it != candidates.end(); ++it)
+      {
+        if (!arrays.is_selected(*it, MOVING_GROUPS))
+          continue;
+        if (dest.overlaps(arrays.get_dest(*it)))
+          checksum_arrays += 1000;
+      }
+    }
+
+    arrays.end_update();
+  }
+  const double arrays_ms = elapsed_ms(start);
+
+  std::cout << "steps: " << step_count << ", objects: " << objects.size() << std::endl;
+  std::cout << "objects: " << objects_ms << " ms (" << objects_ms * 1000.0 / step_count << " us per step)" << std::endl;
+  std::cout << "CollisionArrays: " << arrays_ms << " ms (" << arrays_ms * 1000.0 / step_count << " us per step)" << std::endl;
+
+  if (checksum_objects != checksum_arrays)
+  {
+    std::cerr << "error: the passes found different pairs" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+/* EOF */
@@ -0,0 +1,191 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "collision/collision.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "collision/collision_arrays.hpp"
+#include "collision/collision_grid.hpp"
+#include "collision/collision_group.hpp"
+#include "util/thread_pool.hpp"
+
+namespace {
+
+const int OBJECT_COUNT = 2000;
+const float MAX_SPEED = 16.0f;
+
+const uint8_t MOVING_GROUPS_AND_ONLY_STATIC = (1 << COLGROUP_MOVING) | (1 << COLGROUP_MOVING_STATIC) |
+                                              (1 << COLGROUP_MOVING_ONLY_STATIC);
+const uint8_t STATIC_GROUPS = (1 << COLGROUP_STATIC) | (1 << COLGROUP_MOVING_STATIC);
+
+struct Pair
+{
+  uint32_t index;
+  collision::Constraints vertical;
+  collision::Constraints full;
+};
+
+/** Enemies walking on a crowded level of platforms and bonus blocks,
+    so that most moving objects touch a static one. */
+void spawn(CollisionArrays& arrays, std::mt19937& rng)
+{
+  std::uniform_real_distribution<float> x(0.0f, 4000.0f);
+  std::uniform_real_distribution<float> y(0.0f, 1000.0f);
+  std::uniform_real_distribution<float> speed(-3.0f, 3.0f);
+  std::uniform_int_distribution<int> group(0, 3);
+
+  for (int i = 0; i < OBJECT_COUNT; ++i)
+  {
+    const float left = x(rng);
+    const float top = y(rng);
+    if (group(rng) == 0)
+    {
+      arrays.add(COLGROUP_STATIC, Rectf(left, top, left + 96.0f, top + 32.0f), Vector(0.0f, 0.0f));
+    }
+    else
+    {
+      arrays.add(COLGROUP_MOVING, Rectf(left, top, left + 32.0f, top + 32.0f),
+                 Vector(speed(rng), 2.0f));
+    }
+  }
+}
+
+/** What collision_static() does with the static objects touching a
+    moving one, besides the callbacks. */
+void find_pairs(const CollisionArrays& arrays, uint32_t i, std::vector<uint32_t>& candidates,
+                std::vector<Pair>& pairs)
+{
+  const Rectf& dest = arrays.get_dest(i);
+  const Vector& movement = arrays.get_movement(i);
+  const collision::RectanglePairState state;
+
+  pairs.clear();
+  arrays.get_grid().query(dest, candidates);
+  for (const uint32_t index : candidates)
+  {
+    if (index == i || !arrays.is_selected(index, STATIC_GROUPS))
+      continue;
+
+    Pair pair;
+    pair.index = index;
+    if (!collision::rectangle_rectangle_constraints(&pair.vertical, Vector(0.0f, movement.y),
+                                                    dest, arrays.get_dest(index), state))
+      continue;
+    collision::rectangle_rectangle_constraints(&pair.full, movement, dest, arrays.get_dest(index), state);
+    pairs.push_back(pair);
+  }
+}
+
+/** Stands in for the callbacks, which run in order on the main thread. */
+double apply(const std::vector<Pair>& pairs)
+{
+  double checksum = 0.0;
+  for (const auto& pair : pairs)
+  {
+    checksum += pair.index;
+    if (pair.vertical.has_constraints())
+      checksum += pair.vertical.get_position_bottom() < 1e9f ? pair.vertical.get_position_bottom() : 1.0;
+    if (pair.full.has_constraints())
+      checksum += pair.full.get_x_midpoint() > -1e9f && pair.full.get_x_midpoint() < 1e9f ? 0.5 : 2.0;
+  }
+  return checksum;
+}
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int step_count = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 1000;
+
+  std::mt19937 rng(1);
+  CollisionArrays arrays;
+  spawn(arrays, rng);
+  arrays.begin_update(MAX_SPEED);
+
+  // Candidates and constraints are found on this thread, right before
+  // the callbacks of each object.
+  double checksum_serial = 0.0;
+  std::vector<uint32_t> candidates;
+  std::vector<Pair> pairs;
+  auto start = Clock::now();
+  for (int step = 0; step < step_count; ++step)
+  {
+    for (uint32_t i = 0; i < static_cast<uint32_t>(arrays.size()); ++i)
+    {
+      if (!arrays.is_selected(i, MOVING_GROUPS_AND_ONLY_STATIC))
+        continue;
+
+      find_pairs(arrays, i, candidates, pairs);
+      checksum_serial += apply(pairs);
+    }
+  }
+  const double serial_ms = elapsed_ms(start);
+
+  // Candidates and constraints of all objects are found on the worker
+  // threads first, as CollisionSystem::prefetch_static_constraints()
+  // does.
+  ThreadPool pool((argc > 2) ? static_cast<unsigned int>(std::max(0, std::atoi(argv[2]))) : 0);
+  double checksum_parallel = 0.0;
+  std::vector<std::vector<uint32_t>> all_candidates(arrays.size());
+  std::vector<std::vector<Pair>> all_pairs(arrays.size());
+  start = Clock::now();
+  for (int step = 0; step < step_count; ++step)
+  {
+    pool.parallel_for(arrays.size(), [&](size_t begin, size_t end) {
+      for (uint32_t i = static_cast<uint32_t>(begin); i < end; ++i)
+      {
+        if (arrays.is_selected(i, MOVING_GROUPS_AND_ONLY_STATIC))
+          find_pairs(arrays, i, all_candidates[i], all_pairs[i]);
+      }
+    });
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(arrays.size()); ++i)
+    {
+      if (arrays.is_selected(i, MOVING_GROUPS_AND_ONLY_STATIC))
+        checksum_parallel += apply(all_pairs[i]);
+    }
+  }
+  const double parallel_ms = elapsed_ms(start);
+
+  std::cout << "steps: " << step_count << ", objects: " << arrays.size()
+            << ", worker threads: " << pool.get_thread_count() << std::endl;
+  std::cout << "serial: " << serial_ms << " ms (" << serial_ms * 1000.0 / step_count << " us per step)" << std::endl;
+  std::cout << "prefetched: " << parallel_ms << " ms (" << parallel_ms * 1000.0 / step_count << " us per step)" << std::endl;
+
+  if (checksum_serial != checksum_parallel)
+  {
+    std::cerr << "error: the constraints differ" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+/* EOF */
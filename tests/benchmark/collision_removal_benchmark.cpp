@@ -0,0 +1,201 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "collision/collision_arrays.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "collision/collision_grid.hpp"
+#include "collision/collision_group.hpp"
+
+namespace {
+
+const int OBJECT_COUNT = 10000;
+
+/** Objects spawned or destroyed between two queries, as when a
+    level spawns a swarm of enemies or a bomb takes out a wall. */
+const int OBJECTS_PER_FRAME = 100;
+
+struct Object
+{
+  Rectf bbox;
+  uint32_t slot;
+
+  /** Objects standing on this one, see
+      CollisionObject::notify_object_removal(). */
+  std::unordered_set<Object*> hit_bottom;
+};
+
+std::vector<Rectf> make_boxes(std::mt19937& rng)
+{
+  std::uniform_real_distribution<float> x(0.0f, 20000.0f);
+  std::uniform_real_distribution<float> y(0.0f, 2000.0f);
+
+  std::vector<Rectf> boxes;
+  for (int i = 0; i < OBJECT_COUNT; ++i)
+  {
+    const float left = x(rng);
+    const float top = y(rng);
+    boxes.push_back(Rectf(left, top, left + 32.0f, top + 32.0f));
+  }
+  return boxes;
+}
+
+/** The area of the screen, moved along the level, as queried by
+    is_free_of() and friends. */
+Rectf get_query(int frame)
+{
+  const float left = static_cast<float>((frame * 97) % 19000);
+  return Rectf(left, 500.0f, left + 800.0f, 1100.0f);
+}
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int round_count = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 3;
+
+  std::mt19937 rng(1);
+  const std::vector<Rectf> boxes = make_boxes(rng);
+  std::vector<size_t> removal_order(boxes.size());
+  for (size_t i = 0; i < removal_order.size(); ++i)
+    removal_order[i] = i;
+  std::shuffle(removal_order.begin(), removal_order.end(), rng);
+
+  // Search and erase, notify every object and rebuild the index on the
+  // next query, as CollisionSystem::remove() used to.
+  long checksum_erase = 0;
+  std::vector<uint32_t> candidates;
+  auto start = Clock::now();
+  for (int round = 0; round < round_count; ++round)
+  {
+    std::vector<std::unique_ptr<Object>> storage(boxes.size());
+    std::vector<Object*> objects;
+    CollisionGrid grid;
+    bool index_dirty = true;
+    int frame = 0;
+
+    auto query = [&]() {
+      if (index_dirty)
+      {
+        grid.reset(Rectf(0.0f, 0.0f, 20032.0f, 2032.0f));
+        for (uint32_t i = 0; i < static_cast<uint32_t>(objects.size()); ++i)
+          grid.insert(i, objects[i]->bbox);
+        index_dirty = false;
+      }
+      const Rectf rect = get_query(frame++);
+      grid.query(rect, candidates);
+      for (const uint32_t index : candidates)
+        if (rect.overlaps(objects[index]->bbox))
+          checksum_erase += 1;
+    };
+
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+      storage[i] = std::make_unique<Object>();
+      storage[i]->bbox = boxes[i];
+      objects.push_back(storage[i].get());
+      index_dirty = true;
+      if ((i + 1) % OBJECTS_PER_FRAME == 0)
+        query();
+    }
+
+    for (size_t i = 0; i < removal_order.size(); ++i)
+    {
+      Object* object = storage[removal_order[i]].get();
+      objects.erase(std::find(objects.begin(), objects.end(), object));
+      for (Object* other : objects)
+        other->hit_bottom.erase(object);
+      index_dirty = true;
+      if ((i + 1) % OBJECTS_PER_FRAME == 0 && !objects.empty())
+        query();
+    }
+  }
+  const double erase_ms = elapsed_ms(start);
+
+  // Swap the last object into the freed slot and patch the grid, as
+  // CollisionSystem::remove() does now. Only objects standing on the
+  // removed one are notified, there are none here.
+  long checksum_slots = 0;
+  start = Clock::now();
+  for (int round = 0; round < round_count; ++round)
+  {
+    std::vector<std::unique_ptr<Object>> storage(boxes.size());
+    std::vector<Object*> objects;
+    CollisionArrays arrays;
+    int frame = 0;
+
+    auto query = [&]() {
+      arrays.update_index();
+      const Rectf rect = get_query(frame++);
+      arrays.get_grid().query(rect, candidates);
+      for (const uint32_t index : candidates)
+        if (rect.overlaps(arrays.get_bbox(index)))
+          checksum_slots += 1;
+    };
+
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+      storage[i] = std::make_unique<Object>();
+      storage[i]->bbox = boxes[i];
+      storage[i]->slot = arrays.add(COLGROUP_MOVING, boxes[i], Vector(0.0f, 0.0f));
+      objects.push_back(storage[i].get());
+      if ((i + 1) % OBJECTS_PER_FRAME == 0)
+        query();
+    }
+
+    for (size_t i = 0; i < removal_order.size(); ++i)
+    {
+      Object* object = storage[removal_order[i]].get();
+      const uint32_t slot = object->slot;
+      arrays.remove(slot);
+      objects[slot] = objects.back();
+      objects[slot]->slot = slot;
+      objects.pop_back();
+      if ((i + 1) % OBJECTS_PER_FRAME == 0 && !objects.empty())
+        query();
+    }
+  }
+  const double slots_ms = elapsed_ms(start);
+
+  std::cout << "rounds: " << round_count << ", objects spawned and destroyed per round: " << boxes.size() << std::endl;
+  std::cout << "find and erase: " << erase_ms << " ms (" << erase_ms / round_count << " ms per round)" << std::endl;
+  std::cout << "slots: " << slots_ms << " ms (" << slots_ms / round_count << " ms per round)" << std::endl;
+
+  if (checksum_erase != checksum_slots)
+  {
+    std::cerr << "error: the queries found different objects" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+/* EOF */
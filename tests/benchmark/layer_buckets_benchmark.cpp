@@ -0,0 +1,127 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/layer_buckets.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Request
+{
+  int layer;
+  int id;
+};
+
+/** The layers of the requests of one frame, in the order in which they
+    are made, like on a busy level: backgrounds and tilemaps come in
+    runs, objects and particles interleave their layers. */
+std::vector<Request> make_frame(std::mt19937& rng)
+{
+  std::vector<Request> frame;
+  auto add = [&frame](int layer, int count) {
+    for (int i = 0; i < count; ++i)
+      frame.push_back({ layer, static_cast<int>(frame.size()) });
+  };
+
+  add(-300, 2);
+  add(-200, 40);
+  add(-100, 30);
+  add(0, 60);
+
+  const int object_layers[] = { 50, 50, 50, 49, 51, 150, 65, 40, 199 };
+  std::uniform_int_distribution<size_t> pick(0, std::size(object_layers) - 1);
+  for (int i = 0; i < 600; ++i)
+    add(object_layers[pick(rng)], 1);
+
+  add(200, 40);
+  add(300, 10);
+  add(500, 30);
+  add(600, 20);
+  return frame;
+}
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int frame_count = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 20000;
+
+  std::mt19937 rng(1);
+  std::vector<std::vector<Request>> frames;
+  for (int i = 0; i < 16; ++i)
+    frames.push_back(make_frame(rng));
+
+  long checksum_sort = 0;
+  std::vector<const Request*> requests;
+  auto start = Clock::now();
+  for (int i = 0; i < frame_count; ++i)
+  {
+    requests.clear();
+    for (const auto& request : frames[i % frames.size()])
+      requests.push_back(&request);
+
+    std::stable_sort(requests.begin(), requests.end(),
+                     [](const Request* r1, const Request* r2) { return r1->layer < r2->layer; });
+
+    for (size_t j = 0; j < requests.size(); ++j)
+      checksum_sort += static_cast<long>(j) * requests[j]->id;
+  }
+  const double sort_ms = elapsed_ms(start);
+
+  long checksum_buckets = 0;
+  LayerBuckets<const Request*> buckets;
+  start = Clock::now();
+  for (int i = 0; i < frame_count; ++i)
+  {
+    buckets.clear();
+    for (const auto& request : frames[i % frames.size()])
+      buckets.push_back(request.layer, &request);
+
+    long j = 0;
+    buckets.for_each([&](const Request* request) {
+      checksum_buckets += j * request->id;
+      j += 1;
+    });
+  }
+  const double buckets_ms = elapsed_ms(start);
+
+  std::cout << "frames: " << frame_count << ", requests per frame: " << frames[0].size() << std::endl;
+  std::cout << "stable_sort: " << sort_ms << " ms (" << sort_ms * 1000.0 / frame_count << " us per frame)" << std::endl;
+  std::cout << "LayerBuckets: " << buckets_ms << " ms (" << buckets_ms * 1000.0 / frame_count << " us per frame)" << std::endl;
+
+  if (checksum_sort != checksum_buckets)
+  {
+    std::cerr << "error: the request orders differ" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+/* EOF */
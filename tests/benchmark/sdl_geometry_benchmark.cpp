@@ -0,0 +1,214 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/sdl/sdl_quad_batch.hpp"
+
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "math/rectf.hpp"
+
+namespace {
+
+const int SCREEN_WIDTH = 1280;
+const int SCREEN_HEIGHT = 800;
+const int TILE_SIZE = 32;
+
+struct Quad
+{
+  Rectf srcrect;
+  Rectf dstrect;
+  float angle;
+};
+
+/** One texture request, as Canvas hands it to the painter. */
+struct Request
+{
+  std::vector<Quad> quads;
+  SDL_FColor color;
+};
+
+/** The texture requests of one frame of a typical level: a background,
+    three merged tilemaps covering the screen and a few dozen objects,
+    some of them rotated and tinted. */
+std::vector<Request> make_frame(std::mt19937& rng)
+{
+  std::vector<Request> frame;
+  std::uniform_int_distribution<int> tile(0, 15 * 15 - 1);
+  std::uniform_real_distribution<float> pos(0.0f, 1.0f);
+
+  frame.push_back({ { { Rectf(0, 0, 480, 480), Rectf(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT), 0.0f } },
+                    SDL_FColor{ 1.0f, 1.0f, 1.0f, 1.0f } });
+
+  for (int layer = 0; layer < 3; ++layer)
+  {
+    Request tilemap{ {}, SDL_FColor{ 1.0f, 1.0f, 1.0f, layer == 2 ? 0.5f : 1.0f } };
+    for (int y = 0; y < SCREEN_HEIGHT / TILE_SIZE + 1; ++y)
+    {
+      for (int x = 0; x < SCREEN_WIDTH / TILE_SIZE + 1; ++x)
+      {
+        // Upper layers are sparse.
+        if (layer > 0 && pos(rng) > 0.3f)
+          continue;
+
+        const int id = tile(rng);
+        const float src_x = static_cast<float>((id % 15) * TILE_SIZE);
+        const float src_y = static_cast<float>((id / 15) * TILE_SIZE);
+        tilemap.quads.push_back({ Rectf(src_x, src_y, src_x + TILE_SIZE, src_y + TILE_SIZE),
+                                  Rectf(static_cast<float>(x * TILE_SIZE) - 7.0f,
+                                        static_cast<float>(y * TILE_SIZE) - 3.0f,
+                                        static_cast<float>(x * TILE_SIZE + TILE_SIZE) - 7.0f,
+                                        static_cast<float>(y * TILE_SIZE + TILE_SIZE) - 3.0f),
+                                  0.0f });
+      }
+    }
+    frame.push_back(std::move(tilemap));
+  }
+
+  for (int i = 0; i < 60; ++i)
+  {
+    const float x = pos(rng) * SCREEN_WIDTH;
+    const float y = pos(rng) * SCREEN_HEIGHT;
+    const bool special = (i % 10 == 0);
+    frame.push_back({ { { Rectf(0, 0, 64, 64), Rectf(x, y, x + 64, y + 64), special ? pos(rng) * 360.0f : 0.0f } },
+                      special ? SDL_FColor{ 1.0f, 0.5f, 0.5f, 0.8f } : SDL_FColor{ 1.0f, 1.0f, 1.0f, 1.0f } });
+  }
+
+  return frame;
+}
+
+SDL_Texture* make_texture(SDL_Renderer* renderer)
+{
+  SDL_Surface* surface = SDL_CreateSurface(512, 512, SDL_PIXELFORMAT_RGBA32);
+  if (!surface)
+    return nullptr;
+
+  for (int y = 0; y < surface->h; ++y)
+  {
+    auto* row = reinterpret_cast<Uint32*>(static_cast<Uint8*>(surface->pixels) + y * surface->pitch);
+    for (int x = 0; x < surface->w; ++x)
+      row[x] = SDL_MapSurfaceRGBA(surface, static_cast<Uint8>(x), static_cast<Uint8>(y),
+                                  static_cast<Uint8>(x ^ y), static_cast<Uint8>((x / 8 + y / 8) % 2 ? 255 : 128));
+  }
+
+  SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+  SDL_DestroySurface(surface);
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_LINEAR);
+  return texture;
+}
+
+/** The old SDLPainter::draw_texture(): one copy call per quad. */
+void draw_copies(SDL_Renderer* renderer, SDL_Texture* texture, const std::vector<Request>& frame)
+{
+  for (const auto& request : frame)
+  {
+    for (const auto& quad : request.quads)
+    {
+      SDL_SetTextureColorModFloat(texture, request.color.r, request.color.g, request.color.b);
+      SDL_SetTextureAlphaModFloat(texture, request.color.a);
+
+      const SDL_FRect srcrect = quad.srcrect.to_sdl();
+      const SDL_FRect dstrect = quad.dstrect.to_sdl();
+      SDL_RenderTextureRotated(renderer, texture, &srcrect, &dstrect,
+                               static_cast<double>(quad.angle), nullptr, SDL_FLIP_NONE);
+    }
+  }
+}
+
+/** The batched path: one SDL_RenderGeometry() call per request. */
+void draw_batched(SDL_Renderer* renderer, SDL_Texture* texture, const std::vector<Request>& frame,
+                  SDLQuadBatch& batch)
+{
+  SDL_SetTextureColorModFloat(texture, 1.0f, 1.0f, 1.0f);
+  SDL_SetTextureAlphaModFloat(texture, 1.0f);
+
+  for (const auto& request : frame)
+  {
+    for (const auto& quad : request.quads)
+      batch.add(quad.srcrect, quad.dstrect, quad.angle, SDL_FLIP_NONE, request.color, 512.0f, 512.0f);
+    batch.render(renderer, texture);
+  }
+}
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int frame_count = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 200;
+
+  SDL_Surface* target = SDL_CreateSurface(SCREEN_WIDTH, SCREEN_HEIGHT, SDL_PIXELFORMAT_XRGB8888);
+  SDL_Renderer* renderer = target ? SDL_CreateSoftwareRenderer(target) : nullptr;
+  SDL_Texture* texture = renderer ? make_texture(renderer) : nullptr;
+  if (!texture)
+  {
+    std::cerr << "error: couldn't create the software renderer: " << SDL_GetError() << std::endl;
+    return 1;
+  }
+
+  std::mt19937 rng(1);
+  std::vector<std::vector<Request>> frames;
+  for (int i = 0; i < 8; ++i)
+    frames.push_back(make_frame(rng));
+
+  size_t quad_count = 0;
+  for (const auto& request : frames[0])
+    quad_count += request.quads.size();
+
+  auto start = Clock::now();
+  for (int i = 0; i < frame_count; ++i)
+  {
+    SDL_RenderClear(renderer);
+    draw_copies(renderer, texture, frames[i % frames.size()]);
+    SDL_RenderPresent(renderer);
+  }
+  const double copies_ms = elapsed_ms(start);
+
+  SDLQuadBatch batch;
+  start = Clock::now();
+  for (int i = 0; i < frame_count; ++i)
+  {
+    SDL_RenderClear(renderer);
+    draw_batched(renderer, texture, frames[i % frames.size()], batch);
+    SDL_RenderPresent(renderer);
+  }
+  const double batched_ms = elapsed_ms(start);
+
+  std::cout << "frames: " << frame_count << ", requests per frame: " << frames[0].size()
+            << ", quads per frame: " << quad_count << std::endl;
+  std::cout << "SDL_RenderTextureRotated: " << copies_ms << " ms (" << copies_ms / frame_count << " ms per frame)" << std::endl;
+  std::cout << "SDL_RenderGeometry: " << batched_ms << " ms (" << batched_ms / frame_count << " ms per frame)" << std::endl;
+
+  SDL_DestroyTexture(texture);
+  SDL_DestroyRenderer(renderer);
+  SDL_DestroySurface(target);
+  return 0;
+}
+
+/* EOF */
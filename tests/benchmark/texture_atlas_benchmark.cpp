@@ -0,0 +1,477 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Reports how the tiles of the stock levels end up on texture atlas
+// pages, without a video system: the tilesets are packed like
+// TextureManager::get_packed() does when they are loaded, and the
+// tilemaps of every level are cut into screens, counting the batches
+// TileMap::draw() sends for each of them. A batch is one draw call,
+// as counted by RenderStats::draw_calls.
+//
+// Usage: TextureAtlasBenchmark [DATADIR]
+
+#include "video/texture_atlas.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <sexp/parser.hpp>
+#include <sexp/value.hpp>
+
+namespace {
+
+// Same as in video/texture_manager.cpp.
+const int ATLAS_PAGE_SIZE = 1024;
+const int ATLAS_MAX_IMAGE_SIZE = 128;
+const int ATLAS_PADDING = 1;
+
+// An 800x600 screen, rounded up to whole tiles.
+const int SCREEN_WIDTH = 25;
+const int SCREEN_HEIGHT = 19;
+
+/** Parses a file like ReaderDocument::from_file(), without going
+    through PhysFS. */
+sexp::Value read_file(const std::filesystem::path& filename)
+{
+  std::ifstream in(filename);
+  if (!in)
+    throw std::runtime_error("couldn't open " + filename.generic_string());
+
+  return sexp::Parser::from_stream(in, sexp::Parser::USE_ARRAYS);
+}
+
+/** Returns the name of a list like (name ...), or an empty string. */
+const std::string& get_name(const sexp::Value& sx)
+{
+  static const std::string empty;
+  if (!sx.is_array() || sx.as_array().empty() || !sx.as_array()[0].is_symbol())
+    return empty;
+  return sx.as_array()[0].as_string();
+}
+
+/** Returns the list named name in sx, like ReaderMapping::get_item(). */
+const sexp::Value* get_item(const sexp::Value& sx, const std::string& name)
+{
+  if (!sx.is_array())
+    return nullptr;
+
+  for (const auto& item : sx.as_array())
+    if (get_name(item) == name)
+      return &item;
+  return nullptr;
+}
+
+/** Returns the first value of the list named name in sx. */
+const sexp::Value* get_value(const sexp::Value& sx, const std::string& name)
+{
+  const sexp::Value* item = get_item(sx, name);
+  return (item && item->as_array().size() > 1) ? &item->as_array()[1] : nullptr;
+}
+
+int get_int(const sexp::Value& sx, const std::string& name, int default_value)
+{
+  const sexp::Value* value = get_value(sx, name);
+  return (value && value->is_integer()) ? value->as_int() : default_value;
+}
+
+/** Reads the size from the header of a PNG file. */
+std::optional<Size> get_png_size(const std::filesystem::path& filename)
+{
+  std::ifstream in(filename, std::ios::binary);
+  unsigned char header[24];
+  if (!in.read(reinterpret_cast<char*>(header), sizeof(header)) || header[1] != 'P')
+    return std::nullopt;
+
+  auto read_uint32 = [&header](int offset) {
+    return (header[offset] << 24) | (header[offset + 1] << 16) | (header[offset + 2] << 8) | header[offset + 3];
+  };
+  return Size(read_uint32(16), read_uint32(20));
+}
+
+/** An image like it is given to TextureManager::get_packed() */
+using ImageKey = std::pair<std::string, Rect>;
+
+struct ImageKeyLess
+{
+  bool operator()(const ImageKey& lhs, const ImageKey& rhs) const
+  {
+    if (lhs.first != rhs.first)
+      return lhs.first < rhs.first;
+    return std::make_tuple(lhs.second.left, lhs.second.top, lhs.second.right, lhs.second.bottom) <
+           std::make_tuple(rhs.second.left, rhs.second.top, rhs.second.right, rhs.second.bottom);
+  }
+};
+
+/** Packs the images of a tileset like the TextureManager does, in the
+    order in which they are loaded. */
+class TilesetPacker final
+{
+public:
+  TilesetPacker(const std::filesystem::path& datadir) :
+    m_datadir(datadir),
+    m_pages(),
+    m_textures(),
+    m_tiles(),
+    m_unpacked(0)
+  {}
+
+  void load(const std::string& filename, int offset = 0)
+  {
+    const std::string basedir = filename.substr(0, filename.rfind('/') + 1);
+    const sexp::Value root = read_file(m_datadir / filename);
+
+    for (const auto& item : root.as_array())
+    {
+      if (get_name(item) == "tile")
+      {
+        const int id = get_int(item, "id", 0);
+        if (const sexp::Value* editor_images = get_item(item, "editor-images"))
+          parse_images(basedir, *editor_images, std::nullopt);
+        if (const sexp::Value* images = get_item(item, "images"))
+          add_tile(id + offset, parse_images(basedir, *images, std::nullopt));
+      }
+      else if (get_name(item) == "tiles")
+      {
+        const int width = get_int(item, "width", 0);
+        const int tiles_offset = get_int(item, "offset", 0);
+        const sexp::Value* ids = get_item(item, "ids");
+        const sexp::Value* images = get_item(item, "images") ? get_item(item, "images") : get_item(item, "image");
+        if (!ids || !images || width <= 0)
+          continue;
+
+        const auto& id_values = ids->as_array();
+        for (size_t i = 1; i < id_values.size(); ++i)
+        {
+          const int id = id_values[i].as_int();
+          if (!id)
+            continue;
+
+          const int x = static_cast<int>(32 * ((i - 1) % width));
+          const int y = static_cast<int>(32 * ((i - 1) / width));
+          add_tile(id + offset + tiles_offset,
+                   parse_images(basedir, *images, Rect(x, y, Size(32, 32))));
+        }
+      }
+      else if (get_name(item) == "import-tileset")
+      {
+        if (const sexp::Value* file = get_value(item, "file"))
+          load(file->as_string(), offset + get_int(item, "offset", 0));
+      }
+    }
+  }
+
+  /** Returns the texture a tile is drawn with, before and with the
+      atlas, or -1 for empty and unknown tiles. */
+  int get_texture(int id, bool atlas) const
+  {
+    auto it = m_tiles.find(id);
+    if (it == m_tiles.end())
+      return -1;
+
+    const Image& image = m_textures.at(it->second);
+    return atlas ? image.packed : image.texture;
+  }
+
+  void print(std::ostream& out) const
+  {
+    int count = 0;
+    double occupancy = 0.0;
+    for (size_t i = 0; i < m_pages.size(); ++i)
+    {
+      out << "  page " << i << ": " << m_pages[i]->get_count() << " images, "
+          << std::fixed << std::setprecision(1) << 100.0f * m_pages[i]->get_occupancy() << "% occupied" << std::endl;
+      count += m_pages[i]->get_count();
+      occupancy += m_pages[i]->get_occupancy();
+    }
+    out << "  " << m_textures.size() << " images, " << count << " on "
+        << m_pages.size() << " pages ("
+        << std::setprecision(1) << (m_pages.empty() ? 0.0 : 100.0 * occupancy / static_cast<double>(m_pages.size()))
+        << "% occupied on average), " << m_unpacked << " too large or unreadable" << std::endl;
+  }
+
+private:
+  struct Image
+  {
+    /** Texture of the image without an atlas, every image has its own */
+    int texture;
+
+    /** Texture of the image with the atlas, the page it is on or a
+        texture of its own */
+    int packed;
+  };
+
+private:
+  /** Same as TileSetParser::parse_imagespecs(). */
+  std::vector<ImageKey> parse_images(const std::string& basedir, const sexp::Value& images,
+                                     const std::optional<Rect>& surface_region)
+  {
+    std::vector<ImageKey> keys;
+    const auto& items = images.as_array();
+    for (size_t i = 1; i < items.size(); ++i)
+    {
+      const sexp::Value& item = items[i];
+      if (item.is_string())
+      {
+        keys.push_back(ImageKey(basedir + item.as_string(), surface_region ? *surface_region : Rect()));
+      }
+      else if (get_name(item) == "region" && item.as_array().size() == 6)
+      {
+        const auto& region = item.as_array();
+        const int x = region[2].as_int();
+        const int y = region[3].as_int();
+        Rect rect(x, y, x + region[4].as_int(), y + region[5].as_int());
+        if (surface_region)
+          rect = Rect(rect.left + surface_region->left, rect.top + surface_region->top,
+                      surface_region->get_size());
+        keys.push_back(ImageKey(basedir + region[1].as_string(), rect));
+      }
+    }
+
+    for (const auto& key : keys)
+      load_image(key);
+    return keys;
+  }
+
+  void add_tile(int id, const std::vector<ImageKey>& images)
+  {
+    // Animated tiles are counted with their first frame.
+    if (!images.empty())
+      m_tiles[id] = images.front();
+  }
+
+  void load_image(const ImageKey& key)
+  {
+    if (m_textures.count(key))
+      return;
+
+    const int texture = static_cast<int>(m_textures.size());
+    Image image = { texture, -1 };
+
+    std::optional<Size> size = key.second.empty() ?
+      get_png_size(m_datadir / key.first) :
+      std::optional<Size>(key.second.get_size());
+    if (size && size->width <= ATLAS_MAX_IMAGE_SIZE && size->height <= ATLAS_MAX_IMAGE_SIZE)
+    {
+      for (size_t i = 0; i < m_pages.size() && image.packed < 0; ++i)
+        if (m_pages[i]->insert(*size))
+          image.packed = PAGE_TEXTURES + static_cast<int>(i);
+
+      if (image.packed < 0)
+      {
+        m_pages.push_back(std::make_unique<TextureAtlas>(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, ATLAS_PADDING));
+        if (m_pages.back()->insert(*size))
+          image.packed = PAGE_TEXTURES + static_cast<int>(m_pages.size()) - 1;
+      }
+    }
+
+    if (image.packed < 0)
+    {
+      image.packed = texture;
+      m_unpacked += 1;
+    }
+    m_textures[key] = image;
+  }
+
+private:
+  /** Pages are numbered from here, so they don't collide with the
+      textures of single images. */
+  static const int PAGE_TEXTURES = 1 << 24;
+
+  std::filesystem::path m_datadir;
+  std::vector<std::unique_ptr<TextureAtlas>> m_pages;
+  std::map<ImageKey, Image, ImageKeyLess> m_textures;
+  std::map<int, ImageKey> m_tiles;
+  int m_unpacked;
+};
+
+struct Tilemap
+{
+  int width;
+  int height;
+  std::vector<int> tiles;
+};
+
+void find_tilemaps(const sexp::Value& sx, std::vector<Tilemap>& tilemaps)
+{
+  if (!sx.is_array())
+    return;
+
+  if (get_name(sx) == "tilemap")
+  {
+    const sexp::Value* tiles = get_item(sx, "tiles");
+    Tilemap tilemap{ get_int(sx, "width", 0), get_int(sx, "height", 0), {} };
+    if (!tiles)
+      return;
+
+    // See ReaderMapping::get_compressed().
+    const auto& values = tiles->as_array();
+    int repeater = 0;
+    for (size_t i = 1; i < values.size(); ++i)
+    {
+      const int value = values[i].as_int();
+      if (repeater)
+      {
+        tilemap.tiles.insert(tilemap.tiles.end(), repeater, value);
+        repeater = 0;
+      }
+      else if (value < 0)
+        repeater = -value;
+      else
+        tilemap.tiles.push_back(value);
+    }
+
+    if (static_cast<int>(tilemap.tiles.size()) == tilemap.width * tilemap.height)
+      tilemaps.push_back(std::move(tilemap));
+    return;
+  }
+
+  for (const auto& item : sx.as_array())
+    find_tilemaps(item, tilemaps);
+}
+
+struct Batches
+{
+  long screens = 0;
+  long before = 0;
+  long after = 0;
+};
+
+/** Counts the batches of every screen of a tilemap that isn't empty:
+    one per texture used in it, as TileMap::draw() groups its tiles by
+    texture. */
+void count_batches(const Tilemap& tilemap, const TilesetPacker& tileset, Batches& batches)
+{
+  for (int top = 0; top < tilemap.height; top += SCREEN_HEIGHT)
+  {
+    for (int left = 0; left < tilemap.width; left += SCREEN_WIDTH)
+    {
+      std::set<int> before;
+      std::set<int> after;
+      for (int y = top; y < std::min(top + SCREEN_HEIGHT, tilemap.height); ++y)
+      {
+        for (int x = left; x < std::min(left + SCREEN_WIDTH, tilemap.width); ++x)
+        {
+          const int id = tilemap.tiles[y * tilemap.width + x];
+          if (id == 0 || tileset.get_texture(id, false) < 0)
+            continue;
+
+          before.insert(tileset.get_texture(id, false));
+          after.insert(tileset.get_texture(id, true));
+        }
+      }
+
+      // Empty parts of a tilemap aren't drawn at all.
+      if (before.empty())
+        continue;
+
+      batches.screens += 1;
+      batches.before += static_cast<long>(before.size());
+      batches.after += static_cast<long>(after.size());
+    }
+  }
+}
+
+std::vector<std::string> find_levels(const std::filesystem::path& path)
+{
+  std::vector<std::string> levels;
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
+    if (entry.is_regular_file() && entry.path().extension() == ".stl")
+      levels.push_back(entry.path().lexically_relative(path).generic_string());
+
+  std::sort(levels.begin(), levels.end());
+  return levels;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const std::filesystem::path datadir = argc > 1 ? argv[1] : "data";
+
+  std::map<std::string, std::unique_ptr<TilesetPacker>> tilesets;
+  auto get_tileset = [&](std::string filename) -> const TilesetPacker& {
+    if (!filename.empty() && filename[0] == '/')
+      filename.erase(0, 1);
+
+    auto& tileset = tilesets[filename];
+    if (!tileset)
+    {
+      tileset = std::make_unique<TilesetPacker>(datadir);
+      tileset->load(filename);
+      std::cout << filename << ":" << std::endl;
+      tileset->print(std::cout);
+    }
+    return *tileset;
+  };
+
+  const std::vector<std::string> levels = find_levels(datadir / "levels");
+
+  Batches total;
+  std::ostringstream report;
+  for (const auto& level : levels)
+  {
+    try
+    {
+      const sexp::Value root = read_file(datadir / "levels" / level);
+      const sexp::Value* tileset_file = get_value(root, "tileset");
+      const TilesetPacker& tileset = get_tileset(tileset_file ? tileset_file->as_string() : "images/tiles.strf");
+
+      std::vector<Tilemap> tilemaps;
+      find_tilemaps(root, tilemaps);
+
+      Batches batches;
+      for (const auto& tilemap : tilemaps)
+        count_batches(tilemap, tileset, batches);
+
+      if (batches.screens == 0)
+        continue;
+
+      report << "  " << level << ": " << std::fixed << std::setprecision(1)
+             << static_cast<double>(batches.before) / static_cast<double>(batches.screens) << " -> "
+             << static_cast<double>(batches.after) / static_cast<double>(batches.screens) << std::endl;
+
+      total.screens += batches.screens;
+      total.before += batches.before;
+      total.after += batches.after;
+    }
+    catch (const std::exception& err)
+    {
+      std::cerr << level << ": " << err.what() << std::endl;
+    }
+  }
+
+  std::cout << "tilemap draw calls per screen without -> with atlas:" << std::endl
+            << report.str()
+            << "  all levels: " << std::fixed << std::setprecision(1)
+            << static_cast<double>(total.before) / static_cast<double>(std::max(total.screens, 1L)) << " -> "
+            << static_cast<double>(total.after) / static_cast<double>(std::max(total.screens, 1L))
+            << " (" << total.screens << " screens)" << std::endl;
+  return 0;
+}
+
+/* EOF */
@@ -0,0 +1,81 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "st_assert.hpp"
+#include "collision/collision_arrays.hpp"
+#include "collision/collision_group.hpp"
+
+#include <algorithm>
+#include <vector>
+
+int main(void)
+{
+  CollisionArrays arrays;
+  const uint32_t a = arrays.add(COLGROUP_MOVING, Rectf(0, 0, 10, 10), Vector(100, 0));
+  const uint32_t b = arrays.add(COLGROUP_STATIC, Rectf(1000, 0, 1010, 10), Vector(0, 0));
+  const uint32_t c = arrays.add(COLGROUP_TOUCHABLE, Rectf(2000, 0, 2010, 10), Vector(0, 5));
+  ST_ASSERT("slots are handed out in order", a == 0 && b == 1 && c == 2 && arrays.size() == 3);
+
+  ST_ASSERT("selected by group", arrays.is_selected(a, 1 << COLGROUP_MOVING) &&
+            !arrays.is_selected(b, 1 << COLGROUP_MOVING));
+  arrays.set_valid(a, false);
+  ST_ASSERT("invalid entries are not selected", !arrays.is_selected(a, 1 << COLGROUP_MOVING));
+  arrays.set_valid(a, true);
+
+  arrays.begin_update(16.0f);
+  ST_ASSERT("movement is limited", arrays.get_movement(a) == Vector(16, 0));
+  ST_ASSERT("destination is moved", arrays.get_dest(a) == Rectf(16, 0, 26, 10) &&
+            arrays.get_dest(c) == Rectf(2000, 5, 2010, 15));
+
+  std::vector<uint32_t> result;
+  arrays.get_grid().query(Rectf(2005, 12, 2006, 13), result);
+  ST_ASSERT("grid holds the destinations", result.size() == 1 && result[0] == c);
+
+  arrays.set_dest(a, Rectf(500, 500, 510, 510));
+  ST_ASSERT("broadphase entry is moved", arrays.update_broadphase(a) && !arrays.update_broadphase(a));
+  arrays.end_update();
+  ST_ASSERT("destination becomes the bounding box", arrays.get_bbox(a) == Rectf(500, 500, 510, 510) &&
+            arrays.get_movement(a) == Vector(0, 0));
+
+  arrays.update_index();
+  arrays.get_grid().query(Rectf(501, 501, 502, 502), result);
+  ST_ASSERT("grid holds the bounding boxes", result.size() == 1 && result[0] == a);
+
+  arrays.remove(a);
+  ST_ASSERT("last entry moves into the removed slot", arrays.size() == 2 &&
+            arrays.get_group(a) == COLGROUP_TOUCHABLE && arrays.get_bbox(a) == Rectf(2000, 5, 2010, 15));
+  arrays.get_grid().query(Rectf(2005, 12, 2006, 13), result);
+  ST_ASSERT("grid entry follows the moved entry", result.size() == 1 && result[0] == a);
+  arrays.get_grid().query(Rectf(501, 501, 502, 502), result);
+  ST_ASSERT("grid entry of the removed entry is gone", result.empty());
+
+  const Rectf old_bbox = arrays.get_bbox(b);
+  arrays.set_bbox(b, Rectf(1500, 800, 1510, 810), Rectf(1500, 800, 1510, 810));
+  arrays.get_grid().query(Rectf(1501, 801, 1502, 802), result);
+  ST_ASSERT("grid entry follows changed bounding boxes", result.size() == 1 && result[0] == b);
+  arrays.get_grid().query(old_bbox, result);
+  ST_ASSERT("old grid entry is gone", std::find(result.begin(), result.end(), b) == result.end());
+
+  arrays.invalidate_index();
+  arrays.update_index();
+  arrays.get_grid().query(Rectf(1501, 801, 1502, 802), result);
+  ST_ASSERT("rebuilt index holds the bounding boxes", result.size() == 1 && result[0] == b);
+
+  return 0;
+}
+
+/* EOF */
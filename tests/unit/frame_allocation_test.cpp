@@ -0,0 +1,155 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "st_assert.hpp"
+#include "util/obstackpp.hpp"
+#include "util/span.hpp"
+#include "video/drawing_request.hpp"
+#include "video/layer_buckets.hpp"
+
+#include <stdlib.h>
+#include <new>
+#include <vector>
+
+namespace {
+
+size_t g_allocations = 0;
+
+/** Only compared, never drawn. */
+char g_textures[2];
+
+const Texture* get_texture(int i)
+{
+  return reinterpret_cast<const Texture*>(&g_textures[i]);
+}
+
+/** Adds a texture request like Canvas::draw_surface_batch() does. */
+DrawingRequest* add_request(obstack& obst, LayerBuckets<DrawingRequest*>& requests,
+                            int layer, int texture, Span<const Rectf> rects)
+{
+  auto req = new(obst) DrawingRequest(DrawingTransform(Rect(0, 0, 800, 600)));
+  req->layer = layer;
+  req->request = TextureRequest{};
+  auto& texture_request = std::get<TextureRequest>(req->request);
+  texture_request.texture = get_texture(texture);
+  texture_request.displacement_texture = nullptr;
+  texture_request.color = Color::WHITE;
+  set_texture_geometry(texture_request, obst, rects, rects, Span<const float>());
+  requests.push_back(req->layer, req);
+  return req;
+}
+
+/** Merges the requests like Canvas::render() and drops them like
+    Canvas::clear() and the Compositor at the end of a frame. */
+int end_frame(obstack& obst, LayerBuckets<DrawingRequest*>& requests)
+{
+  int merged = 0;
+  for (auto& bucket : requests.get_buckets())
+    merged += merge_drawing_requests(bucket.items, obst);
+
+  requests.for_each([](DrawingRequest* request) {
+    request->~DrawingRequest();
+  });
+  requests.clear();
+  obstack_reset(obst);
+  return merged;
+}
+
+/** Does what a frame does with the drawing requests. */
+void draw_frame(obstack& obst, LayerBuckets<DrawingRequest*>& requests, int count)
+{
+  const Rectf rects[] = { Rectf(0, 0, 32, 32), Rectf(32, 0, 64, 32), Rectf(64, 0, 96, 32) };
+
+  for (int i = 0; i < count; ++i)
+    add_request(obst, requests, (i % 4) * 100, (i / 16) % 2, Span<const Rectf>(rects, 1 + i % 3));
+
+  end_frame(obst, requests);
+}
+
+} // namespace
+
+void* operator new(size_t size)
+{
+  g_allocations += 1;
+  if (void* ptr = malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+// Not inlined, GCC would warn about free() being called on memory
+// returned by operator new otherwise.
+[[gnu::noinline]] void operator delete(void* ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  operator delete(ptr);
+}
+
+int main(void)
+{
+  std::vector<Rectf> vector(3, Rectf(1, 2, 3, 4));
+  const Span<const Rectf> span(vector);
+  ST_ASSERT("span views vector", span.data() == vector.data() && span.size() == 3);
+  ST_ASSERT("empty span", Span<const float>().empty());
+
+  obstack obst;
+  obstack_init(&obst);
+  LayerBuckets<DrawingRequest*> requests;
+
+  {
+    DrawingRequest* first = add_request(obst, requests, 0, 0, span);
+    add_request(obst, requests, 0, 0, span);
+    DrawingRequest* other = add_request(obst, requests, 0, 1, span);
+    add_request(obst, requests, 100, 0, span);
+
+    const auto& geometry = std::get<TextureRequest>(first->request);
+    ST_ASSERT("geometry is copied onto obstack",
+              geometry.srcrects.data() != vector.data() && geometry.dstrects[2] == vector[2]);
+    ST_ASSERT("missing angles are 0", geometry.angles.size() == 3 && geometry.angles[1] == 0.0f);
+
+    std::vector<DrawingRequest*>& bucket = requests.get_buckets().front().items;
+    ST_ASSERT("same texture is merged", merge_drawing_requests(bucket, obst) == 1);
+    ST_ASSERT("other texture is kept", bucket.size() == 2 && bucket[0] == first && bucket[1] == other);
+    ST_ASSERT("merged geometry", std::get<TextureRequest>(first->request).srcrects.size() == 6);
+    ST_ASSERT("other layer is not merged", end_frame(obst, requests) == 0);
+  }
+
+  // The first frames need more than one chunk and the buckets grow.
+  draw_frame(obst, requests, 2000);
+  draw_frame(obst, requests, 2000);
+
+  size_t allocations = g_allocations;
+  draw_frame(obst, requests, 2000);
+  ST_ASSERT("same frame again does not allocate", g_allocations == allocations);
+
+  allocations = g_allocations;
+  draw_frame(obst, requests, 500);
+  ST_ASSERT("smaller frame does not allocate", g_allocations == allocations);
+
+  draw_frame(obst, requests, 8000);
+  draw_frame(obst, requests, 8000);
+  allocations = g_allocations;
+  draw_frame(obst, requests, 8000);
+  ST_ASSERT("larger frame stops allocating", g_allocations == allocations);
+
+  obstack_free(&obst, nullptr);
+  return 0;
+}
+
+/* EOF */
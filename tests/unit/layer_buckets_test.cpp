@@ -0,0 +1,61 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "st_assert.hpp"
+#include "video/layer_buckets.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+int main(void)
+{
+  const int layers[] = { 50, 50, -100, 600, 0, 50, 450, -300, 0, 600, 50, -100, 199 };
+
+  LayerBuckets<int> buckets;
+  std::vector<std::pair<int, int>> sorted;
+  for (int i = 0; i < static_cast<int>(std::size(layers)); ++i)
+  {
+    buckets.push_back(layers[i], i);
+    sorted.emplace_back(layers[i], i);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  std::vector<int> walked;
+  buckets.for_each([&walked](int item) { walked.push_back(item); });
+
+  bool same_order = walked.size() == sorted.size();
+  for (size_t i = 0; same_order && i < walked.size(); ++i)
+    same_order = walked[i] == sorted[i].second;
+  ST_ASSERT("items are walked like after a stable sort", same_order);
+  ST_ASSERT("one bucket per layer", buckets.get_buckets().size() == 7);
+  ST_ASSERT("filled buckets are not empty", !buckets.empty());
+
+  buckets.clear();
+  ST_ASSERT("clear removes all items", buckets.size() == 0);
+  ST_ASSERT("cleared buckets are empty", buckets.empty());
+  ST_ASSERT("used buckets are kept", buckets.get_buckets().size() == 7);
+
+  buckets.push_back(0, 1);
+  buckets.clear();
+  ST_ASSERT("unused buckets are dropped", buckets.get_buckets().size() == 1);
+
+  return 0;
+}
+
+/* EOF */
@@ -0,0 +1,73 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "st_assert.hpp"
+#include "util/lru_cache.hpp"
+
+#include <string>
+
+int main(void)
+{
+  LRUCache<std::string, int> cache(3);
+  cache.put("a", 1);
+  cache.put("b", 2);
+  cache.put("c", 3);
+  ST_ASSERT("cache holds its capacity", cache.size() == 3);
+
+  ST_ASSERT("value is found", cache.get("a") && *cache.get("a") == 1);
+  cache.put("d", 4);
+  ST_ASSERT("least recently used value is dropped", !cache.get("b"));
+  ST_ASSERT("recently used value is kept", cache.get("a") && cache.get("c") && cache.get("d"));
+
+  cache.put("c", 30);
+  ST_ASSERT("put replaces the value", cache.size() == 3 && *cache.get("c") == 30);
+
+  ST_ASSERT("erase removes the value", cache.erase("a") && !cache.get("a") && cache.size() == 2);
+  ST_ASSERT("erase of missing value", !cache.erase("a"));
+
+  LRUCache<int, int> counted(4);
+  counted.put(1, 1);
+  counted.get(1);
+  counted.get(1);
+  counted.get(1);
+  counted.get(2);
+  ST_ASSERT("hits are counted", counted.get_hits() == 3);
+  ST_ASSERT("misses are counted", counted.get_misses() == 1);
+  ST_ASSERT("hit rate", counted.get_hit_rate() == 0.75f);
+  ST_ASSERT("contains is not counted", counted.contains(1) && !counted.contains(2) &&
+            counted.get_hits() == 3 && counted.get_misses() == 1);
+
+  LRUCache<int, int> budget(100);
+  budget.put(1, 1, 40);
+  budget.put(2, 2, 40);
+  ST_ASSERT("cost is summed", budget.get_cost() == 80);
+  budget.put(3, 3, 40);
+  ST_ASSERT("oldest value makes room", !budget.get(1) && budget.get_cost() == 80);
+  ST_ASSERT("evictions are counted", budget.get_evictions() == 1);
+  budget.put(4, 4, 500);
+  ST_ASSERT("oversized value is kept alone", budget.size() == 1 && budget.get(4) && budget.get_cost() == 500);
+  budget.set_capacity(1000);
+  budget.put(5, 5, 10);
+  budget.set_capacity(10);
+  ST_ASSERT("lowering the capacity drops values", budget.size() == 1 && budget.get(5));
+
+  budget.clear();
+  ST_ASSERT("clear empties the cache", budget.size() == 0 && budget.get_cost() == 0);
+
+  return 0;
+}
+
+/* EOF */
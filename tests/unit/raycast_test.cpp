@@ -0,0 +1,299 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "st_assert.hpp"
+#include "collision/collision.hpp"
+#include "collision/collision_grid.hpp"
+#include "collision/raycast.hpp"
+#include "math/aatriangle.hpp"
+#include "math/rectf.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+const int WIDTH = 16;
+const int HEIGHT = 16;
+
+struct TestTile
+{
+  uint32_t attributes = 0;
+  int data = 0;
+
+  uint32_t get_attributes() const { return attributes; }
+  int get_data() const { return data; }
+  bool is_slope() const { return (attributes & Tile::SLOPE) != 0; }
+};
+
+/** The parts of TileMap that first_tile_intersection() uses. */
+struct TestTilemap
+{
+  TestTile tiles[WIDTH][HEIGHT] = {};
+  Vector offset = Vector(0.0f, 0.0f);
+  Flip flip = NO_FLIP;
+
+  void set_solid(int x, int y) { tiles[x][y].attributes = Tile::SOLID; }
+  void set_slope(int x, int y, int data)
+  {
+    tiles[x][y].attributes = Tile::SOLID | Tile::SLOPE;
+    tiles[x][y].data = data;
+  }
+
+  int get_width() const { return WIDTH; }
+  int get_height() const { return HEIGHT; }
+  Vector get_offset() const { return offset; }
+  Flip get_flip() const { return flip; }
+  const TestTile& get_tile(int x, int y) const { return tiles[x][y]; }
+  Rectf get_bbox() const { return Rectf(offset, offset + Vector(WIDTH * 32.0f, HEIGHT * 32.0f)); }
+  Rectf get_tile_bbox(int x, int y) const
+  {
+    const Vector pos = offset + Vector(static_cast<float>(x), static_cast<float>(y)) * 32.0f;
+    return Rectf(pos, pos + Vector(32.0f, 32.0f));
+  }
+};
+
+/** Tests the line against every tile, for comparing with the traversal. */
+float brute_force_tiles(const TestTilemap& tilemap, const Vector& line_start, const Vector& line_end)
+{
+  float result = std::numeric_limits<float>::infinity();
+  for (int x = 0; x < WIDTH; ++x) {
+    for (int y = 0; y < HEIGHT; ++y) {
+      const TestTile& tile = tilemap.get_tile(x, y);
+      if (!(tile.attributes & Tile::SOLID))
+        continue;
+
+      int data = tile.data;
+      if (tilemap.flip & VERTICAL_FLIP)
+        data = AATriangle::vertical_flip(data);
+      float t;
+      if (tile.is_slope() ?
+          collision::line_aatriangle_intersection(line_start, line_end, AATriangle(tilemap.get_tile_bbox(x, y), data), t) :
+          collision::line_rectangle_intersection(line_start, line_end, tilemap.get_tile_bbox(x, y), t))
+        result = std::min(result, t);
+    }
+  }
+  return result;
+}
+
+collision::LineHit first_tile(const TestTilemap& tilemap, const Vector& line_start, const Vector& line_end)
+{
+  collision::LineHit hit;
+  collision::first_tile_intersection(line_start, line_end, tilemap, hit);
+  return hit;
+}
+
+bool hits_tile(const collision::LineHit& hit, int x, int y)
+{
+  return std::isfinite(hit.t) && hit.x == x && hit.y == y;
+}
+
+struct TestObjects
+{
+  std::vector<Rectf> bboxes;
+  std::vector<bool> ignored;
+  CollisionGrid grid;
+
+  TestObjects() : bboxes(), ignored(), grid(128.0f) {}
+
+  void add(const Rectf& bbox)
+  {
+    grid.insert(static_cast<uint32_t>(bboxes.size()), bbox);
+    bboxes.push_back(bbox);
+    ignored.push_back(false);
+  }
+
+  collision::LineHit first_hit(const Vector& line_start, const Vector& line_end,
+                               float max_t = std::numeric_limits<float>::infinity()) const
+  {
+    collision::LineHit hit;
+    hit.t = max_t;
+    collision::first_object_intersection(line_start, line_end, grid, [this](uint32_t id, Rectf& bbox) {
+      if (ignored[id])
+        return false;
+      bbox = bboxes[id];
+      return true;
+    }, hit);
+    return hit;
+  }
+
+  float brute_force(const Vector& line_start, const Vector& line_end) const
+  {
+    float result = std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < bboxes.size(); ++i) {
+      float t;
+      if (!ignored[i] && collision::line_rectangle_intersection(line_start, line_end, bboxes[i], t))
+        result = std::min(result, t);
+    }
+    return result;
+  }
+};
+
+} // namespace
+
+int main(void)
+{
+  // Tiles along the axes.
+  TestTilemap tilemap;
+  tilemap.set_solid(5, 3);
+  tilemap.set_solid(9, 3);
+  tilemap.set_solid(2, 10);
+  tilemap.set_solid(2, 12);
+
+  ST_ASSERT("horizontal line hits first tile", hits_tile(first_tile(tilemap, Vector(10, 110), Vector(500, 110)), 5, 3));
+  ST_ASSERT("horizontal line hits first tile backwards", hits_tile(first_tile(tilemap, Vector(500, 110), Vector(10, 110)), 9, 3));
+  ST_ASSERT("vertical line hits first tile", hits_tile(first_tile(tilemap, Vector(70, 8), Vector(70, 500)), 2, 10));
+  ST_ASSERT("vertical line hits first tile backwards", hits_tile(first_tile(tilemap, Vector(70, 500), Vector(70, 8)), 2, 12));
+  ST_ASSERT("free line stays free", !std::isfinite(first_tile(tilemap, Vector(10, 10), Vector(500, 10)).t));
+
+  const collision::LineHit entry = first_tile(tilemap, Vector(0, 110), Vector(320, 110));
+  ST_ASSERT("hit at the left side of the tile", entry.t == 0.5f && entry.box == Rectf(160, 96, 192, 128));
+
+  // A shallow line that only dips into the tile row below, and a
+  // diagonal that passes a tile in the bounding box of the line.
+  ST_ASSERT("shallow line hits tile", hits_tile(first_tile(tilemap, Vector(100, 84), Vector(200, 98)), 5, 3));
+  ST_ASSERT("diagonal ignores tile beside it", !std::isfinite(first_tile(tilemap, Vector(0, 0), Vector(200, 200)).t));
+
+  // Earlier hits, e.g. from another tilemap, are kept.
+  collision::LineHit earlier;
+  earlier.t = 0.1f;
+  ST_ASSERT("earlier hit is kept",
+            !collision::first_tile_intersection(Vector(10, 110), Vector(500, 110), tilemap, earlier) && earlier.t == 0.1f);
+
+  // Offset tilemaps, and lines that start outside of the tilemap.
+  TestTilemap moved = tilemap;
+  moved.offset = Vector(-1000.0f, 50.0f);
+  ST_ASSERT("offset tilemap hits first tile",
+            hits_tile(first_tile(moved, Vector(-2000, 160), Vector(0, 160)), 5, 3));
+  ST_ASSERT("offset tilemap reports the tile box",
+            first_tile(moved, Vector(-2000, 160), Vector(0, 160)).box == Rectf(-840, 146, -808, 178));
+  ST_ASSERT("offset tilemap is missed at the old position",
+            !std::isfinite(first_tile(moved, Vector(10, 110), Vector(500, 110)).t));
+
+  // Slopes: the empty half of a slope tile is not an obstacle.
+  TestTilemap slopes;
+  slopes.set_slope(4, 4, AATriangle::SOUTHWEST);
+  slopes.set_solid(5, 5);
+  ST_ASSERT("line through empty half of slope hits tile behind",
+            hits_tile(first_tile(slopes, Vector(140, 110), Vector(200, 170)), 5, 5));
+  const collision::LineHit slope_hit = first_tile(slopes, Vector(200, 152), Vector(100, 152));
+  ST_ASSERT("line through solid half hits slope", hits_tile(slope_hit, 4, 4));
+  ST_ASSERT("line hits slope at the surface", std::abs(slope_hit.t - 0.48f) < 1e-4f);
+
+  // A vertically flipped tilemap turns the slope upside down.
+  slopes.flip = VERTICAL_FLIP;
+  const collision::LineHit flipped_hit = first_tile(slopes, Vector(140, 110), Vector(200, 170));
+  ST_ASSERT("flipped slope blocks the former empty half", hits_tile(flipped_hit, 4, 4));
+  ST_ASSERT("flipped slope is hit at the top", std::abs(flipped_hit.t - 0.3f) < 1e-4f);
+  ST_ASSERT("flipped slope is hit at its surface",
+            std::abs(first_tile(slopes, Vector(200, 152), Vector(100, 152)).t - 0.64f) < 1e-4f);
+
+  // Random lines over random tiles agree with testing every tile.
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> cell(0, WIDTH - 1);
+  std::uniform_int_distribution<int> slope_dir(0, 3);
+  std::uniform_int_distribution<int> slope_deform(0, 4);
+  std::uniform_real_distribution<float> pos(-100.0f, WIDTH * 32.0f + 100.0f);
+  bool tiles_agree = true;
+  for (int round = 0; round < 50; ++round) {
+    TestTilemap random;
+    random.offset = Vector(pos(rng), pos(rng));
+    random.flip = (round % 2) ? VERTICAL_FLIP : NO_FLIP;
+    for (int i = 0; i < 20; ++i) {
+      if (i % 2)
+        random.set_slope(cell(rng), cell(rng), slope_dir(rng) | (slope_deform(rng) << 4));
+      else
+        random.set_solid(cell(rng), cell(rng));
+    }
+    for (int i = 0; i < 100; ++i) {
+      const Vector start = random.offset + Vector(pos(rng), pos(rng));
+      const Vector end = random.offset + Vector(pos(rng), pos(rng));
+      const float expected = brute_force_tiles(random, start, end);
+      const float t = first_tile(random, start, end).t;
+      if (std::isfinite(expected) != std::isfinite(t) || (std::isfinite(t) && std::abs(expected - t) > 1e-4f))
+        tiles_agree = false;
+    }
+  }
+  ST_ASSERT("tile traversal agrees with testing every tile", tiles_agree);
+
+  // Objects are found through the cells of the grid that the line passes.
+  TestObjects objects;
+  objects.grid.reset(Rectf(0, 0, 1024, 1024));
+  objects.add(Rectf(300, 100, 332, 132));
+  objects.add(Rectf(600, 100, 632, 132));
+  objects.add(Rectf(100, 500, 900, 520));
+  objects.add(Rectf(2000, 100, 2032, 132));
+
+  const collision::LineHit object_hit = objects.first_hit(Vector(0, 116), Vector(1000, 116));
+  ST_ASSERT("line hits first object", object_hit.id == 0 && object_hit.t == 0.3f);
+  ST_ASSERT("line hits object box", object_hit.box == Rectf(300, 100, 332, 132));
+  ST_ASSERT("line hits first object backwards", objects.first_hit(Vector(1000, 116), Vector(0, 116)).id == 1);
+  ST_ASSERT("object behind a tile is ignored", objects.first_hit(Vector(0, 116), Vector(1000, 116), 0.2f).t == 0.2f);
+  ST_ASSERT("object outside of the grid is found",
+            objects.first_hit(Vector(1500, 116), Vector(2500, 116)).id == 3);
+  ST_ASSERT("long object is found in every cell", objects.first_hit(Vector(850, 400), Vector(850, 600)).id == 2);
+
+  objects.ignored[0] = true;
+  ST_ASSERT("ignored object is skipped", objects.first_hit(Vector(0, 116), Vector(1000, 116)).id == 1);
+  objects.ignored[0] = false;
+
+  // Random lines over random objects agree with testing every object.
+  TestObjects random_objects;
+  random_objects.grid.reset(Rectf(0, 0, 1024, 1024));
+  std::uniform_real_distribution<float> object_pos(-200.0f, 1200.0f);
+  std::uniform_real_distribution<float> object_size(4.0f, 200.0f);
+  for (int i = 0; i < 60; ++i) {
+    const Vector p(object_pos(rng), object_pos(rng));
+    random_objects.add(Rectf(p, p + Vector(object_size(rng), object_size(rng))));
+  }
+  bool objects_agree = true;
+  for (int i = 0; i < 2000; ++i) {
+    const Vector start(object_pos(rng), object_pos(rng));
+    const Vector end(object_pos(rng), object_pos(rng));
+    const float expected = random_objects.brute_force(start, end);
+    const float t = random_objects.first_hit(start, end).t;
+    if (std::isfinite(expected) != std::isfinite(t) || (std::isfinite(t) && std::abs(expected - t) > 1e-5f))
+      objects_agree = false;
+  }
+  ST_ASSERT("object search agrees with testing every object", objects_agree);
+
+  // Line vs. rectangle: for lines starting and ending outside of the
+  // rectangle, the edge test and the slab test agree.
+  const Rectf rect(100, 100, 164, 132);
+  const Vector lines[][2] = {
+    { Vector(0, 0), Vector(300, 300) },
+    { Vector(0, 116), Vector(300, 116) },
+    { Vector(132, 0), Vector(132, 300) },
+    { Vector(0, 0), Vector(300, 50) },
+    { Vector(90, 140), Vector(170, 90) },
+    { Vector(170, 140), Vector(90, 200) },
+  };
+  for (const auto& line : lines) {
+    float t;
+    ST_ASSERT("line vs rectangle matches edge test",
+              collision::intersects_line(rect, line[0], line[1]) ==
+              collision::line_rectangle_intersection(line[0], line[1], rect, t));
+  }
+
+  float t = -1.0f;
+  ST_ASSERT("line starting inside rectangle",
+            collision::line_rectangle_intersection(Vector(120, 116), Vector(300, 116), rect, t) && t == 0.0f);
+
+  return 0;
+}
+
+/* EOF */
@@ -0,0 +1,65 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "st_assert.hpp"
+#include "video/texture_atlas.hpp"
+
+#include <vector>
+
+int main(void)
+{
+  TextureAtlas atlas(256, 256);
+
+  std::vector<Rect> rects;
+  // Tiles first, then some taller sprite frames and small glyphs.
+  for (int i = 0; i < 20; ++i)
+    rects.push_back(*atlas.insert(Size(32, 32)));
+  for (int i = 0; i < 6; ++i)
+    rects.push_back(*atlas.insert(Size(24, 60)));
+  for (int i = 0; i < 30; ++i)
+    rects.push_back(*atlas.insert(Size(9, 14)));
+
+  ST_ASSERT("all images are counted", atlas.get_count() == static_cast<int>(rects.size()));
+
+  bool inside = true;
+  bool apart = true;
+  for (size_t i = 0; i < rects.size(); ++i)
+  {
+    const Rect padded(rects[i].left - 1, rects[i].top - 1, rects[i].right + 1, rects[i].bottom + 1);
+    inside &= padded.left >= 0 && padded.top >= 0 && padded.right <= 256 && padded.bottom <= 256;
+
+    for (size_t j = i + 1; j < rects.size(); ++j)
+      apart &= (rects[j].right <= padded.left || rects[j].left >= padded.right ||
+                rects[j].bottom <= padded.top || rects[j].top >= padded.bottom);
+  }
+  ST_ASSERT("images and padding stay on the page", inside);
+  ST_ASSERT("padding separates images", apart);
+
+  ST_ASSERT("taller image starts a new shelf", rects[20].top == 3 * 34 + 1);
+  ST_ASSERT("too large image is rejected", !atlas.insert(Size(255, 10)));
+  ST_ASSERT("empty image is rejected", !atlas.insert(Size(0, 10)));
+
+  TextureAtlas tiles(1024, 1024);
+  int count = 0;
+  while (tiles.insert(Size(32, 32)))
+    count += 1;
+  ST_ASSERT("padded tiles fill the page", count == 30 * 30);
+  ST_ASSERT("occupancy of a full page", tiles.get_occupancy() > 0.87f && tiles.get_occupancy() < 0.88f);
+
+  return 0;
+}
+
+/* EOF */
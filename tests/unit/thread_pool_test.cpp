@@ -0,0 +1,52 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "st_assert.hpp"
+#include "util/thread_pool.hpp"
+
+#include <atomic>
+
+int main(void)
+{
+  ThreadPool pool(3);
+  ST_ASSERT("pool starts the requested threads", pool.get_thread_count() == 3);
+
+  std::vector<int> visits(1000, 0);
+  std::atomic<int> calls(0);
+  pool.parallel_for(visits.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+      visits[i] += 1;
+    calls += 1;
+  });
+
+  bool all_once = true;
+  for (const int count : visits)
+    all_once &= (count == 1);
+  ST_ASSERT("every index is visited once", all_once);
+  ST_ASSERT("work is split between the threads", calls == 4);
+
+  calls = 0;
+  pool.parallel_for(2, [&](size_t begin, size_t end) { calls += static_cast<int>(end - begin); });
+  ST_ASSERT("fewer items than threads", calls == 2);
+
+  calls = 0;
+  pool.parallel_for(0, [&](size_t, size_t) { calls += 1; });
+  ST_ASSERT("nothing to do", calls == 0);
+
+  return 0;
+}
+
+/* EOF */
@@ -0,0 +1,15 @@
+# This generated file provides version information.
+# See mk/cmake/SuperTux/BuildVersion.cmake
+
+set(SUPERTUX_PACKAGE_VERSION_TAG "GIT_TAG-NOTFOUND")
+if(OFF)
+  set(SUPERTUX_PACKAGE_VERSION "GIT_TAG-NOTFOUND")
+  set(SUPERTUX_VERSION_STRING "GIT_TAG-NOTFOUND")
+else()
+  if(NOT 128 EQUAL 0)
+    set(SUPERTUX_PACKAGE_VERSION "dev d8d1edb (master)")
+  else()
+    set(SUPERTUX_PACKAGE_VERSION "dev GIT_TAG-NOTFOUND - d8d1edb (master)")
+  endif()
+  set(SUPERTUX_VERSION_STRING "master-d8d1edb")
+endif()